@@ -0,0 +1,59 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+namespace FieaGameEngine::Benchmarks
+{
+	/// <summary>
+	/// The clock every benchmark is timed against.
+	/// </summary>
+	using Clock = std::chrono::steady_clock;
+
+	/// <summary>
+	/// Calls the provided function once to warm caches and allocators, then the provided number of times, and returns the average number of milliseconds taken per call.
+	/// </summary>
+	/// <param name="function">The function being timed.</param>
+	/// <param name="repetitions">The number of timed calls.</param>
+	/// <returns>The average duration of a timed call, in milliseconds.</returns>
+	template <typename Function>
+	double AverageMilliseconds(Function&& function, std::size_t repetitions)
+	{
+		function();
+		const Clock::time_point start = Clock::now();
+		for (std::size_t i = 0; i < repetitions; i++)
+		{
+			function();
+		}
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / repetitions;
+	}
+
+	/// <summary>
+	/// Returns the number of milliseconds elapsed since the provided time point.
+	/// </summary>
+	/// <param name="start">The time point measured from.</param>
+	/// <returns>The elapsed time, in milliseconds.</returns>
+	inline double MillisecondsSince(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	/// <summary>
+	/// Times a recursive Walk and a ScopeVisitor over hierarchies of 1,000 to 1,000,000 scopes allocated in shuffled order, before and after ScopeRelayout places them depth first.
+	/// </summary>
+	void TraversalBenchmark();
+
+	/// <summary>
+	/// Times ScopePublisher's Publish and Acquire and a read pass over live and published worlds of 100 to 10,000 objects, then counts frames published and passes read in one second with one, two and four reader threads.
+	/// </summary>
+	void PublisherBenchmark();
+
+	/// <summary>
+	/// Times each DatumMath operation against the per-element loop doing the same work, over Integer, Float and Vector datums of 1,000 to 1,000,000 elements.
+	/// </summary>
+	void DatumMathBenchmark();
+
+	/// <summary>
+	/// Times SetFromString against the sscanf based parser it replaced on 200,000 Integer, Float, Vector and Matrix values, and times SetAllFromString reading them as one array.
+	/// </summary>
+	void ParseBenchmark();
+}
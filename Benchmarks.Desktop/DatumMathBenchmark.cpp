@@ -0,0 +1,75 @@
+#include "Benchmark.h"
+#include "Datum.h"
+#include "DatumMath.h"
+#include <algorithm>
+#include <cstdio>
+
+/// <summary>
+/// The DatumMath benchmark, which measures the bulk arithmetic kernels against the per-element loops that actions would otherwise run.
+/// </summary>
+namespace FieaGameEngine::Benchmarks
+{
+	/// <summary>
+	/// Times a per-element loop and the DatumMath call doing the same work over the provided number of elements, and prints both with the speedup.
+	/// </summary>
+	/// <param name="count">The number of elements each call changes.</param>
+	/// <param name="name">The name of the operation timed.</param>
+	/// <param name="loop">The per-element loop.</param>
+	/// <param name="bulk">The DatumMath call.</param>
+	template <typename Loop, typename Bulk>
+	static void Compare(size_t count, const char* name, Loop&& loop, Bulk&& bulk)
+	{
+		//Every operation touches about twenty million elements in total, so that small arrays are not timed by a handful of calls.
+		const size_t repetitions = std::max<size_t>(1, 20000000 / count);
+		const double loopNanoseconds = AverageMilliseconds(loop, repetitions) * 1000000.0 / count;
+		const double bulkNanoseconds = AverageMilliseconds(bulk, repetitions) * 1000000.0 / count;
+		printf("%8zu %-24s %10.3f %10.3f %7.1fx\n", count, name, loopNanoseconds, bulkNanoseconds, loopNanoseconds / bulkNanoseconds);
+	}
+
+	void DatumMathBenchmark()
+	{
+		printf("%8s %-24s %10s %10s %8s\n", "Elements", "Operation", "Loop ns", "Bulk ns", "Speedup");
+		for (size_t count : { 1000u, 10000u, 100000u, 1000000u })
+		{
+			Datum floats;
+			Datum weights;
+			Datum integers;
+			Datum vectors;
+			for (size_t i = 0; i < count; i++)
+			{
+				floats.PushBack(static_cast<float>(i % 97));
+				weights.PushBack(static_cast<float>(i % 7) + 1.0f);
+				integers.PushBack(i % 97);
+				vectors.PushBack(glm::vec4(static_cast<float>(i % 13)));
+			}
+			const Datum one(1.0f);
+			const Datum half(0.5f);
+			const Datum low(0.0f);
+			const Datum high(50.0f);
+			const Datum integerOne(static_cast<size_t>(1));
+			const Datum offset(glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+
+			Compare(count, "Float += scalar",
+				[&floats, count] { for (size_t i = 0; i < count; i++) { floats.GetFloat(i) += 1.0f; } },
+				[&floats, &one] { DatumMath::Add(floats, one); });
+			Compare(count, "Float *= element-wise",
+				[&floats, &weights, count] { for (size_t i = 0; i < count; i++) { floats.GetFloat(i) *= weights.GetConstFloat(i); } },
+				[&floats, &weights] { DatumMath::Multiply(floats, weights); });
+			Compare(count, "Float /= element-wise",
+				[&floats, &weights, count] { for (size_t i = 0; i < count; i++) { floats.GetFloat(i) /= weights.GetConstFloat(i); } },
+				[&floats, &weights] { DatumMath::Divide(floats, weights); });
+			Compare(count, "Float clamp",
+				[&floats, count] { for (size_t i = 0; i < count; i++) { floats.GetFloat(i) = std::clamp(floats.GetFloat(i), 0.0f, 50.0f); } },
+				[&floats, &low, &high] { DatumMath::Clamp(floats, low, high); });
+			Compare(count, "Float = Float * 0.5 + 1",
+				[&floats, count] { for (size_t i = 0; i < count; i++) { floats.GetFloat(i) = floats.GetFloat(i) * 0.5f + 1.0f; } },
+				[&floats, &half, &one] { DatumMath::MultiplyAdd(floats, half, one); });
+			Compare(count, "Integer += scalar",
+				[&integers, count] { for (size_t i = 0; i < count; i++) { integers.GetInt(i) += 1; } },
+				[&integers, &integerOne] { DatumMath::Add(integers, integerOne); });
+			Compare(count, "Vector += vec4",
+				[&vectors, count] { for (size_t i = 0; i < count; i++) { glm::vec4& vector = vectors.GetVector(i); vector.x += 1.0f; vector.y += 2.0f; vector.z += 3.0f; vector.w += 4.0f; } },
+				[&vectors, &offset] { DatumMath::Add(vectors, offset); });
+		}
+	}
+}
@@ -0,0 +1,166 @@
+#include "Benchmark.h"
+#include "Datum.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// The parse benchmark, which measures the Datum string parser against the sscanf based parser it replaced.
+/// </summary>
+namespace FieaGameEngine::Benchmarks
+{
+	/// <summary>
+	/// The parser SetFromString used before it was rewritten, kept as the baseline: it copies the text into a std::string and reads every number with sscanf_s. Elements are read into locals
+	/// and then set, where the old parser scanned straight into the Datum's storage.
+	/// </summary>
+	/// <param name="datum">The datum being set.</param>
+	/// <param name="value">The text being parsed.</param>
+	/// <param name="index">The index of the element being set.</param>
+	/// <returns>True if the text was parsed, false otherwise.</returns>
+	static bool ScanfSetFromString(Datum& datum, const char* value, size_t index = 0)
+	{
+		if (index < datum.Size() && value != nullptr)
+		{
+			std::string stringValue = value;
+			switch (datum.Type())
+			{
+			case Datum::DatumTypes::Integer:
+			{
+				unsigned int integer;
+				if (sscanf_s(value, "%u", &integer) == 1)
+				{
+					datum.SetInt(integer, index);
+					return true;
+				}
+				break;
+			}
+			case Datum::DatumTypes::Float:
+			{
+				float number;
+				if (sscanf_s(value, "%f", &number) == 1)
+				{
+					datum.SetFloat(number, index);
+					return true;
+				}
+				break;
+			}
+			case Datum::DatumTypes::String:
+				datum.SetString(stringValue, index);
+				return true;
+			case Datum::DatumTypes::Vector:
+			{
+				glm::vec4 vector;
+				if (sscanf_s(value, "vec4(%f, %f, %f, %f)", &vector.x, &vector.y, &vector.z, &vector.w) == 4)
+				{
+					datum.SetVector(vector, index);
+					return true;
+				}
+				break;
+			}
+			case Datum::DatumTypes::Matrix:
+			{
+				glm::mat4 matrix(0.0f);
+				if (sscanf_s(value, "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))", &matrix[0][0], &matrix[0][1], &matrix[0][2], &matrix[0][3],
+					&matrix[1][0], &matrix[1][1], &matrix[1][2], &matrix[1][3],
+					&matrix[2][0], &matrix[2][1], &matrix[2][2], &matrix[2][3],
+					&matrix[3][0], &matrix[3][1], &matrix[3][2], &matrix[3][3]) == 16)
+				{
+					datum.SetMatrix(matrix, index);
+					return true;
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		}
+		return false;
+	}
+
+	/// <summary>
+	/// Parses every provided value into the first element of the provided datum with the provided parser, and returns the average number of nanoseconds taken per value.
+	/// </summary>
+	/// <param name="datum">The datum being set, already holding one element of the type parsed.</param>
+	/// <param name="values">The text of every value parsed.</param>
+	/// <param name="parse">The parser timed, either SetFromString or the sscanf baseline.</param>
+	/// <returns>The average duration of one parse, in nanoseconds.</returns>
+	template <typename Parse>
+	static double NanosecondsPerValue(Datum& datum, const std::vector<std::string>& values, Parse&& parse)
+	{
+		const double milliseconds = AverageMilliseconds([&datum, &values, &parse]
+		{
+			for (const std::string& value : values)
+			{
+				if (!parse(datum, value.c_str()))
+				{
+					printf("Failed to parse %s\n", value.c_str());
+				}
+			}
+		}, 3);
+		return milliseconds * 1000000.0 / values.size();
+	}
+
+	void ParseBenchmark()
+	{
+		const size_t count = 200000;
+		std::vector<std::string> integers;
+		std::vector<std::string> floats;
+		std::vector<std::string> vectors;
+		std::vector<std::string> matrices;
+		for (size_t i = 0; i < count; i++)
+		{
+			integers.push_back(std::to_string(i * 7919 % 1000003));
+			floats.push_back(std::to_string(static_cast<float>(i) * 0.37f - 1000.0f));
+			vectors.push_back("vec4(" + floats.back() + ", 2.5, -3.125, " + std::to_string(i) + ")");
+			std::string matrix = "mat4x4(";
+			for (size_t column = 0; column < 4; column++)
+			{
+				matrix += column == 0 ? "(" : ", (";
+				for (size_t row = 0; row < 4; row++)
+				{
+					matrix += (row == 0 ? "" : ", ") + std::to_string(static_cast<float>(i + column * 4 + row) * 0.5f);
+				}
+				matrix += ")";
+			}
+			matrices.push_back(matrix + ")");
+		}
+
+		Datum integer(static_cast<size_t>(0));
+		Datum number(0.0f);
+		Datum vector(glm::vec4(0.0f));
+		Datum matrix(glm::mat4(0.0f));
+		const auto parse = [](Datum& datum, const char* value) { return datum.SetFromString(value); };
+		const auto baselineParse = [](Datum& datum, const char* value) { return ScanfSetFromString(datum, value); };
+		printf("%-8s %10s %14s %8s\n", "Type", "sscanf ns", "Parser ns", "Speedup");
+		const struct
+		{
+			const char* Name;
+			Datum& Target;
+			const std::vector<std::string>& Values;
+		} cases[] =
+		{
+			{ "Integer", integer, integers },
+			{ "Float", number, floats },
+			{ "Vector", vector, vectors },
+			{ "Matrix", matrix, matrices },
+		};
+		for (const auto& parseCase : cases)
+		{
+			const double baseline = NanosecondsPerValue(parseCase.Target, parseCase.Values, baselineParse);
+			const double current = NanosecondsPerValue(parseCase.Target, parseCase.Values, parse);
+			printf("%-8s %10.1f %14.1f %7.1fx\n", parseCase.Name, baseline, current, baseline / current);
+		}
+
+		//SetAllFromString reads a whole array in one call, where the baseline had to be handed each element on its own.
+		std::string text;
+		for (const std::string& value : floats)
+		{
+			text += value;
+			text += ", ";
+		}
+		Datum bulk;
+		bulk.SetType(Datum::DatumTypes::Float);
+		const double bulkNanoseconds = AverageMilliseconds([&bulk, &text] { static_cast<void>(bulk.SetAllFromString(text)); }, 3) * 1000000.0 / count;
+		printf("SetAllFromString: %zu Floats at %.1f ns each (%.0f MB/s)\n", bulk.Size(), bulkNanoseconds, text.size() / (bulkNanoseconds * count) * 1000.0);
+	}
+}
@@ -0,0 +1,98 @@
+#include "Benchmark.h"
+#include "ScopePublisher.h"
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// The publisher benchmark, which measures what ScopePublisher costs the writer and what it lets any number of readers do alongside it.
+/// </summary>
+namespace FieaGameEngine::Benchmarks
+{
+	/// <summary>
+	/// Reads the health and position of every object in the provided world, as a render or audio thread reading a published frame would.
+	/// </summary>
+	/// <param name="world">The world read, holding its objects under "Object".</param>
+	/// <returns>The sum of every value read, so that the reads cannot be optimized away.</returns>
+	static float ReadPass(const Scope& world)
+	{
+		float sum = 0;
+		const Datum* objects = world.Find("Object");
+		for (size_t i = 0; i < objects->Size(); i++)
+		{
+			const Scope* object = objects->GetConstScope(i);
+			sum += object->Find("Health")->GetConstFloat() + object->Find("Position")->GetConstVector().x;
+		}
+		return sum;
+	}
+
+	void PublisherBenchmark()
+	{
+		volatile float sink = 0;
+		for (size_t count : { 100u, 1000u, 10000u })
+		{
+			Scope world;
+			for (size_t i = 0; i < count; i++)
+			{
+				Scope* object = new Scope;
+				world.Adopt(object, "Object");
+				object->Append("Health") = static_cast<float>(i);
+				object->Append("Position") = glm::vec4(1.0f);
+				object->Append("Name") = "Object" + std::to_string(i);
+				object->Append("Id") = i;
+			}
+
+			ScopePublisher publisher(world);
+			const size_t repetitions = count >= 10000 ? 20 : 200;
+			const double publish = AverageMilliseconds([&publisher] { static_cast<void>(publisher.Publish()); }, repetitions);
+			const double live = AverageMilliseconds([&world, &sink] { sink = sink + ReadPass(world); }, repetitions * 10);
+			ScopePublisher::Snapshot snapshot = publisher.Acquire();
+			const double published = AverageMilliseconds([&snapshot, &sink] { sink = sink + ReadPass(*snapshot); }, repetitions * 10);
+			snapshot.reset();
+			const double acquire = AverageMilliseconds([&publisher, &sink] { sink = sink + static_cast<float>(publisher.Acquire().use_count()); }, 1000000) * 1000000.0;
+			printf("%6zu objects: Publish %8.3f ms | Read pass live %8.3f ms, published %8.3f ms | Acquire %5.1f ns\n", count, publish, live, published, acquire);
+
+			//The writer keeps changing and publishing the world for one second while every reader reads whatever was last published.
+			for (size_t readerCount : { 1u, 2u, 4u })
+			{
+				std::atomic<bool> stop = false;
+				std::atomic<size_t> passes = 0;
+				std::vector<std::thread> readers;
+				for (size_t i = 0; i < readerCount; i++)
+				{
+					readers.emplace_back([&publisher, &stop, &passes, &sink]
+					{
+						float sum = 0;
+						while (!stop)
+						{
+							sum += ReadPass(*publisher.Acquire());
+							passes++;
+						}
+						sink = sink + sum;
+					});
+				}
+
+				size_t frames = 0;
+				const Clock::time_point start = Clock::now();
+				while (MillisecondsSince(start) < 1000.0)
+				{
+					Datum& objects = *world.Find("Object");
+					for (size_t i = 0; i < objects.Size(); i++)
+					{
+						objects.GetScope(i)->Find("Health")->GetFloat() += 1.0f;
+					}
+					static_cast<void>(publisher.Publish());
+					frames++;
+				}
+				stop = true;
+				for (std::thread& reader : readers)
+				{
+					reader.join();
+				}
+				printf("        %zu reader(s) for 1 s: %zu frames published, %zu read passes\n", readerCount, frames, passes.load());
+			}
+		}
+	}
+}
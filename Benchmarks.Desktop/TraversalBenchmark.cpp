@@ -0,0 +1,87 @@
+#include "Benchmark.h"
+#include "Scope.h"
+#include "ScopeRelayout.h"
+#include "ScopeVisitor.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/// <summary>
+/// The traversal benchmark, which measures how much placing a hierarchy's scopes in depth first order speeds up walking it.
+/// </summary>
+namespace FieaGameEngine::Benchmarks
+{
+	/// <summary>
+	/// Sums the Float datums of the provided scope and every scope nested inside of it, reading each scope the way gameplay code does.
+	/// </summary>
+	/// <param name="scope">The scope walked.</param>
+	/// <param name="sum">The running sum of every Float read.</param>
+	static void Walk(const Scope& scope, float& sum)
+	{
+		for (size_t i = 0; i < scope.Size(); i++)
+		{
+			const Datum& datum = scope[i];
+			if (datum.Type() == Datum::DatumTypes::Table)
+			{
+				for (size_t j = 0; j < datum.Size(); j++)
+				{
+					Walk(*datum.GetConstScope(j), sum);
+				}
+			}
+			else if (datum.Type() == Datum::DatumTypes::Float)
+			{
+				sum += datum.GetConstFloat();
+			}
+		}
+	}
+
+	void TraversalBenchmark()
+	{
+		ScopeRelayout::RegisterType<Scope>();
+		for (size_t count : { 1000u, 10000u, 100000u, 1000000u })
+		{
+			//Scopes are allocated in shuffled order with unrelated allocations between them, as a parser interleaves them with its own work.
+			std::mt19937 random(7);
+			std::vector<Scope*> scopes(count);
+			std::vector<size_t> order(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				order[i] = i;
+			}
+			std::shuffle(order.begin(), order.end(), random);
+			std::vector<std::vector<char>> noise;
+			for (size_t i : order)
+			{
+				scopes[i] = new Scope;
+				scopes[i]->Append("Position") = static_cast<float>(i % 10);
+				noise.emplace_back(64 + random() % 512);
+			}
+
+			//Each scope has eight children, so that the hierarchy is both wide and deep.
+			Scope root;
+			for (size_t i = 0; i < count; i++)
+			{
+				Scope& parent = i < 8 ? root : *scopes[(i - 8) / 8];
+				parent.Adopt(scopes[i], "Child");
+			}
+			noise.clear();
+
+			float sum = 0;
+			size_t visited = 0;
+			ScopeVisitor visitor([&visited](Scope& scope) { visited += scope.Size(); });
+			const size_t repetitions = count > 100000 ? 10 : 40;
+			const double walkBefore = AverageMilliseconds([&root, &sum] { Walk(root, sum); }, repetitions);
+			const double visitBefore = AverageMilliseconds([&visitor, &root] { visitor.Visit(root); }, repetitions);
+
+			const Clock::time_point start = Clock::now();
+			ScopeRelayout::Relayout(root, ScopeRelayout::LayoutOrder::DepthFirst);
+			const double relayout = MillisecondsSince(start);
+
+			const double walkAfter = AverageMilliseconds([&root, &sum] { Walk(root, sum); }, repetitions);
+			const double visitAfter = AverageMilliseconds([&visitor, &root] { visitor.Visit(root); }, repetitions);
+			printf("%7zu scopes: Relayout %7.2f ms | Walk %7.2f -> %7.2f ms (%.2fx) | ScopeVisitor %7.2f -> %7.2f ms (%.2fx) [%g %zu]\n", count, relayout, walkBefore, walkAfter,
+				walkBefore / walkAfter, visitBefore, visitAfter, visitBefore / visitAfter, sum, visited);
+		}
+	}
+}
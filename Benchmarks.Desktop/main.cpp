@@ -0,0 +1,39 @@
+#include "Benchmark.h"
+#include <cstdio>
+#include <cstring>
+
+using namespace FieaGameEngine::Benchmarks;
+
+/// <summary>
+/// Runs every benchmark, or only those named on the command line, such as "Benchmarks.Desktop Traversal". Intended to be run from a Release build, as timings from a Debug build say little.
+/// </summary>
+int main(int argc, char* argv[])
+{
+	struct NamedBenchmark
+	{
+		const char* Name;
+		void (*Run)();
+	};
+	const NamedBenchmark benchmarks[] =
+	{
+		{ "Traversal", TraversalBenchmark },
+		{ "Publisher", PublisherBenchmark },
+		{ "DatumMath", DatumMathBenchmark },
+		{ "Parse", ParseBenchmark },
+	};
+
+	for (const NamedBenchmark& benchmark : benchmarks)
+	{
+		bool selected = argc < 2;
+		for (int i = 1; i < argc; i++)
+		{
+			selected = selected || strcmp(argv[i], benchmark.Name) == 0;
+		}
+		if (selected)
+		{
+			printf("%s\n", benchmark.Name);
+			benchmark.Run();
+		}
+	}
+	return 0;
+}
@@ -40,6 +40,25 @@ namespace FieaGameEngine
 		return signatureArray;
 	}
 
+	std::pair<Datum*, size_t> Action::SearchTarget(const std::string& target, size_t index)
+	{
+		if (target != CompiledTarget)
+		{
+			CompiledTarget = target;
+			try
+			{
+				TargetPath = ScopePath(target);
+			}
+			catch (const std::runtime_error&)
+			{
+				TargetPath = ScopePath();
+			}
+		}
+
+		auto [targetDatum, targetIndex] = TargetPath.Search(*this);
+		return std::pair<Datum*, size_t>(targetDatum, TargetPath.HasElementIndex() ? targetIndex : index);
+	}
+
 	void Action::UpdateNestedActions(Datum* targetDatum, const GameTime& currentTime)
 	{
 		if (targetDatum != nullptr)
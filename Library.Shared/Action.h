@@ -1,6 +1,7 @@
 #pragma once
 #include "Attributed.h"
 #include "GameState.h"
+#include "ScopePath.h"
 
 namespace FieaGameEngine
 {
@@ -93,5 +94,23 @@ namespace FieaGameEngine
 		/// <param name="targetDatum">A pointer to the Datum being descended into.</param>
 		/// <param name="currentTime">A const reference to the current Game Time.</param>
 		void UpdateNestedActions(Datum* targetDatum, const GameTime& currentTime);
+
+	protected:
+		/// <summary>
+		/// Resolves a target named by a derived Action, such as "Children.Enemy.Health[2]", searching from the calling action and its ancestors as Scope::Search does. The target is parsed into a
+		/// ScopePath the first time it is seen, and the compiled path is reused every update until the target changes. An index given by the last step of the target overrides the provided index.
+		/// Targets that cannot be parsed resolve to nothing.
+		/// </summary>
+		/// <param name="target">The dotted path naming the target Datum.</param>
+		/// <param name="index">The element index used when the target does not name one.</param>
+		/// <returns>A pair made up of the target Datum and element index. The Datum* is nullptr if the target could not be resolved.</returns>
+		std::pair<Datum*, size_t> SearchTarget(const std::string& target, size_t index);
+
+	private:
+		/// <summary>
+		/// The target most recently passed to SearchTarget, and the path it was compiled into.
+		/// </summary>
+		std::string CompiledTarget;
+		ScopePath TargetPath;
 	};
 }
\ No newline at end of file
@@ -12,16 +12,16 @@ namespace FieaGameEngine
 	void ActionDecrement::Update(const GameTime& currentTime)
 	{
 		currentTime;
-		Datum* targetDatum = Search(Target);
+		auto [targetDatum, targetIndex] = SearchTarget(Target, Index);
 		if (targetDatum != nullptr && targetDatum->Type() == Datum::DatumTypes::Integer)
 		{
-			if (Step > targetDatum->GetInt(Index))
+			if (Step > targetDatum->GetInt(targetIndex))
 			{
-				targetDatum->SetInt(0, Index);
+				targetDatum->SetInt(0, targetIndex);
 			}
 			else
 			{
-				targetDatum->SetInt(targetDatum->GetInt(Index) - Step, Index);
+				targetDatum->SetInt(targetDatum->GetInt(targetIndex) - Step, targetIndex);
 			}
 		}
 	}
@@ -13,10 +13,10 @@ namespace FieaGameEngine
 	void ActionDivide::Update(const GameTime& currentTime)
 	{
 		currentTime;
-		Datum* targetDatum = Search(Target);
-		if (targetDatum != nullptr && targetDatum->Type() == Datum::DatumTypes::Integer && targetDatum->Size() >= Index && Divisor != 0)
+		auto [targetDatum, targetIndex] = SearchTarget(Target, Index);
+		if (targetDatum != nullptr && targetDatum->Type() == Datum::DatumTypes::Integer && targetDatum->Size() >= targetIndex && Divisor != 0)
 		{
-			targetDatum->SetInt(targetDatum->GetInt(Index) / Divisor, Index);
+			targetDatum->SetInt(targetDatum->GetInt(targetIndex) / Divisor, targetIndex);
 		}
 	}
 
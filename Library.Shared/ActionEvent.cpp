@@ -21,13 +21,7 @@ namespace FieaGameEngine
 
 	void ActionEvent::CopyAuxiliaryAttributes(EventMessageAttributed& newEvent) const
 	{
-		auto auxRange = GetAuxiliaryAttributes();
-		for (size_t i = auxRange.first; i < auxRange.second; i++)
-		{
-			auto keypair = GetPair(i);
-			auto& currentAttribute = newEvent.AppendAuxiliaryAttribute(keypair.first);
-			currentAttribute = keypair.second;
-		}
+		newEvent.CopyAttributesFrom(AuxiliaryAttributes());
 	}
 
 	Vector<Signature> ActionEvent::Signatures()
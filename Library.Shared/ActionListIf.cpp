@@ -14,7 +14,7 @@ namespace FieaGameEngine
 	{
 		Vector<Signature> signatureArray;
 		signatureArray = Action::Signatures();
-		signatureArray.PushBack(Signature{"Condition", Datum::DatumTypes::Integer, 1, offsetof(ActionListIf, Condition) });
+		signatureArray.PushBack(Signature{"Condition", Datum::DatumTypes::Boolean, 1, offsetof(ActionListIf, Condition) });
 		signatureArray.PushBack(Signature{ "TrueBlock", Datum::DatumTypes::Table, 1, 0 });
 		signatureArray.PushBack(Signature{ "FalseBlock", Datum::DatumTypes::Table, 1, 0 });
 		return signatureArray;
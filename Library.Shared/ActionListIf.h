@@ -22,7 +22,7 @@ namespace FieaGameEngine
 		/// <param name="currentTime">The current in-game time specified as a const reference to a GameTime instance.</param>
 		virtual void Update(const GameTime& currentTime) override;
 		/// <summary>
-		/// The signatures method for the ActionListIf class. This specifies the prescribed attributes for the base Action class, as well as three new ones: Condition (an integer determining whether to execute the true
+		/// The signatures method for the ActionListIf class. This specifies the prescribed attributes for the base Action class, as well as three new ones: Condition (a boolean determining whether to execute the true
 		/// or false block of actions), TrueBlock (A table for the one or several action lists containing Actions to execute when the condition is true), and FalseBlock (A table for the one or several action lists containing
 		/// actions to execute when the condition is false).
 		/// </summary>
@@ -30,9 +30,9 @@ namespace FieaGameEngine
 		static Vector<Signature> Signatures();
 	private:
 		/// <summary>
-		/// A size_t indicating which block of actions should be updated. 0 is false, while any other value is true.
+		/// A bool indicating which block of actions should be updated.
 		/// </summary>
-		size_t Condition = 0;
+		bool Condition = false;
 	};
 	ConcreteFactory(ActionListIf, Scope);
 }
\ No newline at end of file
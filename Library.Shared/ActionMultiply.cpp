@@ -14,10 +14,10 @@ namespace FieaGameEngine
 	void ActionMultiply::Update(const GameTime& currentTime)
 	{
 		currentTime;
-		Datum* targetDatum = Search(Target);
-		if (targetDatum != nullptr && targetDatum->Type() == Datum::DatumTypes::Integer && targetDatum->Size() >= Index)
+		auto [targetDatum, targetIndex] = SearchTarget(Target, Index);
+		if (targetDatum != nullptr && targetDatum->Type() == Datum::DatumTypes::Integer && targetDatum->Size() >= targetIndex)
 		{
-			targetDatum->SetInt(targetDatum->GetInt(Index) * Multiplier, Index);
+			targetDatum->SetInt(targetDatum->GetInt(targetIndex) * Multiplier, targetIndex);
 		}
 	}
 
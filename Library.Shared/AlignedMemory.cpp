@@ -0,0 +1,50 @@
+#include "AlignedMemory.h"
+#include <algorithm>
+#include <cstdlib>
+#include <malloc.h>
+
+/// <summary>
+/// Method definitions to support the AlignedMemory class.
+/// </summary>
+namespace FieaGameEngine
+{
+	void* AlignedMemory::Allocate(size_t bytes, size_t alignment)
+	{
+		assert(bytes > 0 && alignment >= MinimumAlignment && (alignment & (alignment - 1)) == 0);
+#if defined(_MSC_VER)
+		return _aligned_malloc(bytes, alignment);
+#else
+		return std::aligned_alloc(alignment, (bytes + alignment - 1) & ~(alignment - 1)); //aligned_alloc requires a size that is a multiple of the alignment.
+#endif
+	}
+
+	void* AlignedMemory::Reallocate(void* block, size_t keptBytes, size_t bytes, size_t alignment)
+	{
+		assert(bytes > 0 && alignment >= MinimumAlignment && (alignment & (alignment - 1)) == 0);
+#if defined(_MSC_VER)
+		UNREFERENCED_LOCAL(keptBytes);
+		return _aligned_realloc(block, bytes, alignment);
+#else
+		if (alignment <= alignof(std::max_align_t))
+		{
+			return realloc(block, bytes); //Any block realloc returns has this alignment, and it may grow the block in place rather than copying it.
+		}
+		void* newBlock = Allocate(bytes, alignment);
+		if (newBlock != nullptr && block != nullptr)
+		{
+			memcpy(newBlock, block, std::min(keptBytes, bytes));
+			free(block);
+		}
+		return newBlock;
+#endif
+	}
+
+	void AlignedMemory::Free(void* block)
+	{
+#if defined(_MSC_VER)
+		_aligned_free(block);
+#else
+		free(block);
+#endif
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// The AlignedMemory class, which allocates the element arrays of the library's containers, such as Datum and Vector, at an alignment chosen by their element type rather than the alignment of
+	/// max_align_t that malloc guarantees. Arrays of Vectors start on a 16 byte boundary and arrays of Matrices on a 64 byte boundary, and since each alignment divides the size of its element, every
+	/// element of the array is aligned as well, so the arrays may be read with aligned SIMD loads and glm's aligned types may be enabled.
+	///
+	/// Blocks allocated here must be resized with Reallocate and released with Free, always at the alignment they were allocated with, and never with realloc or free.
+	/// </summary>
+	class AlignedMemory final
+	{
+	public:
+		/// <summary>
+		/// The smallest alignment used for any block, matching the width of an SSE register.
+		/// </summary>
+		static constexpr size_t MinimumAlignment = 16;
+		/// <summary>
+		/// The largest alignment used for any block, matching the width of a cache line and of an AVX-512 register.
+		/// </summary>
+		static constexpr size_t MaximumAlignment = 64;
+
+		AlignedMemory() = delete;
+
+		/// <summary>
+		/// Returns the alignment used for arrays of type T: the largest power of two dividing the size of T, clamped between MinimumAlignment and MaximumAlignment, and never less than the alignment
+		/// T requires.
+		/// </summary>
+		/// <returns>A size_t indicating the alignment in bytes for arrays of type T.</returns>
+		template <typename T>
+		[[nodiscard]] static constexpr size_t AlignmentOf();
+		/// <summary>
+		/// Allocates an uninitialized block of at least the provided number of bytes, starting at the provided alignment.
+		/// </summary>
+		/// <param name="bytes">The number of bytes to allocate, which must not be zero.</param>
+		/// <param name="alignment">The alignment of the block, which must be a power of two no less than MinimumAlignment.</param>
+		/// <returns>A pointer to the start of the new block, or nullptr if it could not be allocated.</returns>
+		[[nodiscard]] static void* Allocate(size_t bytes, size_t alignment);
+		/// <summary>
+		/// Resizes a block, as realloc does, keeping its alignment. The leading bytes of the block are carried over, and the block may move. A null block is allocated as if by Allocate.
+		/// </summary>
+		/// <param name="block">The block to resize, allocated at the provided alignment, or nullptr.</param>
+		/// <param name="keptBytes">The number of leading bytes of the block that hold data, which are preserved up to the new size.</param>
+		/// <param name="bytes">The new size of the block in bytes, which must not be zero.</param>
+		/// <param name="alignment">The alignment the block was allocated with.</param>
+		/// <returns>A pointer to the start of the resized block, or nullptr if it could not be allocated, in which case the original block is left as it was.</returns>
+		[[nodiscard]] static void* Reallocate(void* block, size_t keptBytes, size_t bytes, size_t alignment);
+		/// <summary>
+		/// Releases a block allocated by Allocate or Reallocate. Does nothing when given nullptr.
+		/// </summary>
+		/// <param name="block">The block to release.</param>
+		static void Free(void* block);
+	};
+}
+
+#include "AlignedMemory.inl"
@@ -0,0 +1,13 @@
+#include "AlignedMemory.h"
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	inline constexpr size_t AlignedMemory::AlignmentOf()
+	{
+		size_t alignment = sizeof(T) & (~sizeof(T) + 1); //The lowest set bit of the size is the largest power of two dividing it.
+		alignment = alignment < MinimumAlignment ? MinimumAlignment : alignment;
+		alignment = alignment > MaximumAlignment ? MaximumAlignment : alignment;
+		return alignment < alignof(T) ? alignof(T) : alignment;
+	}
+}
@@ -0,0 +1,186 @@
+#include "AttributeIndex.h"
+#include "ScopeVisitor.h"
+
+/// <summary>
+/// Method definitions to support the AttributeIndexBase class.
+/// </summary>
+namespace FieaGameEngine
+{
+	std::atomic<size_t> AttributeIndexBase::LiveIndexes{ 0 };
+
+	AttributeIndexBase::AttributeIndexBase(Scope& root, std::string key, IndexKind kind) :
+		RootScope(&root), IndexKey(std::move(key)), StructureKind(kind), NextIndex(root.Indexes)
+	{
+		root.Indexes = this;
+		LiveIndexes++;
+
+		ScopeVisitor([this](Scope& scope)
+		{
+			if (scope.Find(IndexKey) != nullptr)
+			{
+				MarkStale(scope);
+			}
+		}).Visit(root);
+	}
+
+	AttributeIndexBase::~AttributeIndexBase()
+	{
+		if (RootScope != nullptr)
+		{
+			AttributeIndexBase** link = &RootScope->Indexes;
+			while (*link != this)
+			{
+				link = &(*link)->NextIndex;
+			}
+			*link = NextIndex;
+		}
+		LiveIndexes--;
+	}
+
+	const std::string& AttributeIndexBase::Key() const
+	{
+		return IndexKey;
+	}
+
+	AttributeIndexBase::IndexKind AttributeIndexBase::Kind() const
+	{
+		return StructureKind;
+	}
+
+	Scope* AttributeIndexBase::Root() const
+	{
+		return RootScope;
+	}
+
+	void AttributeIndexBase::MarkStale(Scope& scope)
+	{
+		const ScopeHandle handle = ScopeHandleTable::HandleOf(scope);
+		const std::uint64_t packed = Pack(handle);
+		std::lock_guard<std::mutex> lock(StaleMutex);
+		while (StaleMarks.Size() <= handle.Index)
+		{
+			if (StaleMarks.Size() == StaleMarks.Capacity())
+			{
+				StaleMarks.Reserve(std::max<size_t>(StaleMarks.Capacity() * 2, InitialStale));
+			}
+			StaleMarks.PushBack(0);
+		}
+		if (StaleMarks[handle.Index] == packed)
+		{
+			return; //Already listed since the last query.
+		}
+		StaleMarks[handle.Index] = packed;
+		if (Stale.Size() == Stale.Capacity())
+		{
+			Stale.Reserve(std::max<size_t>(Stale.Capacity() * 2, InitialStale));
+		}
+		Stale.PushBack(packed);
+	}
+
+	void AttributeIndexBase::Flush()
+	{
+		Vector<std::uint64_t> stale;
+		{
+			std::lock_guard<std::mutex> lock(StaleMutex);
+			stale = std::move(Stale);
+			for (size_t i = 0; i < stale.Size(); i++)
+			{
+				StaleMarks[static_cast<std::uint32_t>(stale[i])] = 0;
+			}
+		}
+		for (size_t i = 0; i < stale.Size(); i++)
+		{
+			Refresh(stale[i], Resolve(stale[i]));
+		}
+	}
+
+	bool AttributeIndexBase::Covers(const Scope& scope) const
+	{
+		return RootScope != nullptr && (&scope == RootScope || scope.IsDescendantOf(*RootScope));
+	}
+
+	std::uint64_t AttributeIndexBase::Pack(ScopeHandle handle)
+	{
+		return (static_cast<std::uint64_t>(handle.Generation) << 32) | handle.Index;
+	}
+
+	Scope* AttributeIndexBase::Resolve(std::uint64_t handle)
+	{
+		return ScopeHandleTable::Resolve(ScopeHandle{ static_cast<std::uint32_t>(handle), static_cast<std::uint32_t>(handle >> 32) });
+	}
+
+	void AttributeIndexBase::ScopeChanged(Scope& scope, const std::string* key)
+	{
+		for (Scope* ancestor = &scope; ancestor != nullptr; ancestor = ancestor->Parent)
+		{
+			for (AttributeIndexBase* index = ancestor->Indexes; index != nullptr; index = index->NextIndex)
+			{
+				//A cleared scope can only have been indexed if it was given a handle.
+				if (key == nullptr ? scope.HandleSlot != ScopeHandleTable::NoSlot : *key == index->IndexKey)
+				{
+					index->MarkStale(scope);
+				}
+			}
+		}
+	}
+
+	void AttributeIndexBase::ScopeAdopted(Scope& child)
+	{
+		Vector<AttributeIndexBase*> indexes;
+		for (Scope* ancestor = child.Parent; ancestor != nullptr; ancestor = ancestor->Parent)
+		{
+			for (AttributeIndexBase* index = ancestor->Indexes; index != nullptr; index = index->NextIndex)
+			{
+				indexes.PushBack(index);
+			}
+		}
+		if (indexes.IsEmpty())
+		{
+			return;
+		}
+
+		ScopeVisitor([&indexes](Scope& scope)
+		{
+			for (size_t i = 0; i < indexes.Size(); i++)
+			{
+				if (scope.Find(indexes[i]->IndexKey) != nullptr)
+				{
+					indexes[i]->MarkStale(scope);
+				}
+			}
+		}).Visit(child);
+	}
+
+	void AttributeIndexBase::TransferIndexes(Scope& from, Scope& to)
+	{
+		AttributeIndexBase** link = &to.Indexes;
+		while (*link != nullptr)
+		{
+			link = &(*link)->NextIndex;
+		}
+		*link = from.Indexes;
+		for (AttributeIndexBase* index = from.Indexes; index != nullptr; index = index->NextIndex)
+		{
+			index->RootScope = &to;
+		}
+		from.Indexes = nullptr;
+	}
+
+	void AttributeIndexBase::DetachIndexes(Scope& root)
+	{
+		AttributeIndexBase* index = root.Indexes;
+		while (index != nullptr)
+		{
+			AttributeIndexBase* next = index->NextIndex;
+			index->RootScope = nullptr;
+			index->NextIndex = nullptr;
+			index = next;
+		}
+		root.Indexes = nullptr;
+	}
+
+	bool AttributeIndexBase::AnyIndexes()
+	{
+		return LiveIndexes.load(std::memory_order_relaxed) > 0;
+	}
+}
@@ -0,0 +1,226 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include "Scope.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// The AttributeIndexBase class, which holds the parts of an AttributeIndex that do not depend on the indexed type: the root scope and key being indexed, and the set of scopes whose value may have
+	/// changed since the index was last queried. Scopes notify the indexes of their ancestors as their Datums change, which only marks the changed scope as stale; stale scopes are re-read the next time
+	/// the index is queried, so a value written many times between queries is indexed once. Marking scopes stale is synchronized, so that the workers of a parallel visit may write to indexed scopes.
+	/// </summary>
+	class AttributeIndexBase
+	{
+	public:
+		/// <summary>
+		/// The structure used to look up indexed values. Hash indexes answer equality queries, while Sorted indexes also answer range queries at the cost of ordered inserts.
+		/// </summary>
+		enum class IndexKind
+		{
+			Hash,
+			Sorted
+		};
+
+		AttributeIndexBase(const AttributeIndexBase&) = delete;
+		AttributeIndexBase& operator=(const AttributeIndexBase&) = delete;
+		AttributeIndexBase(AttributeIndexBase&&) = delete;
+		AttributeIndexBase& operator=(AttributeIndexBase&&) = delete;
+		/// <summary>
+		/// Destructor for the AttributeIndexBase, which detaches the index from its root scope.
+		/// </summary>
+		virtual ~AttributeIndexBase();
+
+		/// <summary>
+		/// Returns the key of the attribute being indexed.
+		/// </summary>
+		/// <returns>A const reference to the indexed key.</returns>
+		[[nodiscard]] const std::string& Key() const;
+		/// <summary>
+		/// Returns the structure used by the index.
+		/// </summary>
+		/// <returns>The IndexKind of the index.</returns>
+		[[nodiscard]] IndexKind Kind() const;
+		/// <summary>
+		/// Returns the scope whose hierarchy is indexed, or nullptr if that scope has been destroyed, after which every query returns no results.
+		/// </summary>
+		/// <returns>A pointer to the indexed root scope.</returns>
+		[[nodiscard]] Scope* Root() const;
+		/// <summary>
+		/// Marks the provided scope as changed, so that its value is re-read by the next query. Writes made through a Datum are observed automatically, but writes made directly to the external storage
+		/// of a prescribed attribute bypass the Datum, and must be reported with this function.
+		/// </summary>
+		/// <param name="scope">The scope whose indexed value may have changed.</param>
+		void MarkStale(Scope& scope);
+
+	protected:
+		/// <summary>
+		/// Constructor for the AttributeIndexBase, attaching the index to the provided root and marking every scope in its hierarchy that holds the key as stale.
+		/// </summary>
+		/// <param name="root">The scope whose hierarchy is indexed, including the scope itself.</param>
+		/// <param name="key">The key of the attribute to index.</param>
+		/// <param name="kind">The structure used to look up indexed values.</param>
+		AttributeIndexBase(Scope& root, std::string key, IndexKind kind);
+
+		/// <summary>
+		/// Re-reads every stale scope, passing each to Refresh. Called at the start of every query.
+		/// </summary>
+		void Flush();
+		/// <summary>
+		/// Returns a boolean indicating whether or not the provided scope is the root or is nested inside of it, and so belongs in the index.
+		/// </summary>
+		[[nodiscard]] bool Covers(const Scope& scope) const;
+		/// <summary>
+		/// Replaces the indexed value of the scope with the provided handle. Scope is the scope the handle resolves to, or nullptr if it has been destroyed, in which case its value is removed.
+		/// </summary>
+		virtual void Refresh(std::uint64_t handle, Scope* scope) = 0;
+
+		/// <summary>
+		/// Packs a scope handle into the single integer used to identify indexed scopes.
+		/// </summary>
+		[[nodiscard]] static std::uint64_t Pack(ScopeHandle handle);
+		/// <summary>
+		/// Resolves a packed scope handle, returning nullptr if the scope has been destroyed.
+		/// </summary>
+		[[nodiscard]] static Scope* Resolve(std::uint64_t handle);
+
+	private:
+		friend Scope;
+
+		/// <summary>
+		/// Called by Scope when a Datum of the provided scope may change, or with a null key when the scope is cleared. Marks the scope stale in every index of it or its ancestors that indexes the key.
+		/// </summary>
+		static void ScopeChanged(Scope& scope, const std::string* key);
+		/// <summary>
+		/// Called by Scope when the provided scope is adopted. Marks every scope in its hierarchy stale in the indexes of its new ancestors, as it carries its values into them.
+		/// </summary>
+		static void ScopeAdopted(Scope& child);
+		/// <summary>
+		/// Called by Scope when it is moved, handing the indexes of one scope over to the scope its contents were moved into.
+		/// </summary>
+		static void TransferIndexes(Scope& from, Scope& to);
+		/// <summary>
+		/// Called by Scope when it is destroyed, leaving each of its indexes without a root.
+		/// </summary>
+		static void DetachIndexes(Scope& root);
+		/// <summary>
+		/// Returns a boolean indicating whether or not any index exists, allowing scopes to skip notifying their ancestors otherwise.
+		/// </summary>
+		[[nodiscard]] static bool AnyIndexes();
+
+		Scope* RootScope;
+		std::string IndexKey;
+		IndexKind StructureKind;
+		/// <summary>
+		/// The next index attached to the same root scope.
+		/// </summary>
+		AttributeIndexBase* NextIndex{ nullptr };
+		/// <summary>
+		/// The packed handles of the scopes whose values must be re-read before the next query, each listed once.
+		/// </summary>
+		Vector<std::uint64_t> Stale;
+		/// <summary>
+		/// The packed handle last added to Stale for each handle slot, or zero if none has been since the last query, so that a scope written many times between queries is listed once without
+		/// searching the list. Packed handles are never zero, as generations start at one.
+		/// </summary>
+		Vector<std::uint64_t> StaleMarks;
+		/// <summary>
+		/// Guards Stale and StaleMarks, which are added to from whichever thread writes to an indexed scope.
+		/// </summary>
+		std::mutex StaleMutex;
+		/// <summary>
+		/// The number of elements reserved by Stale and StaleMarks when they are first added to. Both double their reservation whenever full.
+		/// </summary>
+		static constexpr size_t InitialStale = 64;
+
+		/// <summary>
+		/// The number of indexes that currently exist. Atomic, as scopes read it on whichever thread destroys or writes to them.
+		/// </summary>
+		static std::atomic<size_t> LiveIndexes;
+	};
+
+	/// <summary>
+	/// The AttributeIndex class, an opt-in secondary index over the values of one attribute across a Scope hierarchy, allowing queries such as "every scope whose Health is below 10" to be answered
+	/// without walking the hierarchy and calling Find on each scope. The first element of the attribute is indexed, for every scope in the hierarchy whose attribute holds the indexed type and is not
+	/// empty. T must be size_t, float or std::string, matching the Integer, Float and String Datum types.
+	///
+	/// The index follows the hierarchy as it changes: Datum writes, appends, adoptions and clears beneath the root are picked up by the next query, scopes that are destroyed or orphaned drop out of it,
+	/// and scopes relocated by ScopeRelayout are still found, as the index refers to scopes by handle. Writes made directly to a prescribed attribute's member must be reported with MarkStale. Indexes
+	/// are only synchronized against Datum writes, as made by the workers of a parallel visit, so queries and structural changes to an indexed hierarchy must not run on more than one thread at a time.
+	/// </summary>
+	template <typename T>
+	class AttributeIndex final : public AttributeIndexBase
+	{
+		static_assert(std::is_same_v<T, size_t> || std::is_same_v<T, float> || std::is_same_v<T, std::string>, "Attributes may only be indexed as size_t, float or std::string.");
+
+	public:
+		/// <summary>
+		/// Constructor for the AttributeIndex, indexing the provided key across the hierarchy of the provided root. The index must be destroyed before the root, or not queried after it.
+		/// </summary>
+		/// <param name="root">The scope whose hierarchy is indexed, including the scope itself.</param>
+		/// <param name="key">The key of the attribute to index.</param>
+		/// <param name="kind">The structure used to look up indexed values, Hash by default.</param>
+		AttributeIndex(Scope& root, std::string key, IndexKind kind = IndexKind::Hash);
+
+		/// <summary>
+		/// Returns every indexed scope whose attribute equals the provided value.
+		/// </summary>
+		/// <param name="value">The value being searched for.</param>
+		/// <returns>A Vector of the matching scopes, in no particular order.</returns>
+		[[nodiscard]] Vector<Scope*> Equal(const T& value);
+		/// <summary>
+		/// Returns every indexed scope whose attribute is less than the provided value, in ascending order of value. Throws a runtime error unless the index is Sorted.
+		/// </summary>
+		/// <param name="value">The exclusive upper bound of the values searched for.</param>
+		/// <returns>A Vector of the matching scopes.</returns>
+		[[nodiscard]] Vector<Scope*> Less(const T& value);
+		/// <summary>
+		/// Returns every indexed scope whose attribute is greater than the provided value, in ascending order of value. Throws a runtime error unless the index is Sorted.
+		/// </summary>
+		/// <param name="value">The exclusive lower bound of the values searched for.</param>
+		/// <returns>A Vector of the matching scopes.</returns>
+		[[nodiscard]] Vector<Scope*> Greater(const T& value);
+		/// <summary>
+		/// Returns every indexed scope whose attribute lies between the provided values, inclusive of both, in ascending order of value. Throws a runtime error unless the index is Sorted.
+		/// </summary>
+		/// <param name="low">The inclusive lower bound of the values searched for.</param>
+		/// <param name="high">The inclusive upper bound of the values searched for.</param>
+		/// <returns>A Vector of the matching scopes.</returns>
+		[[nodiscard]] Vector<Scope*> Between(const T& low, const T& high);
+		/// <summary>
+		/// Returns the number of scopes whose attribute is currently indexed.
+		/// </summary>
+		/// <returns>A size_t indicating the number of indexed scopes.</returns>
+		[[nodiscard]] size_t Size();
+
+	private:
+		void Refresh(std::uint64_t handle, Scope* scope) override;
+		void ThrowUnlessSorted() const;
+		[[nodiscard]] bool ReadValue(const Scope& scope, T& value) const;
+		template <typename Iterator>
+		[[nodiscard]] Vector<Scope*> Collect(Iterator first, Iterator last);
+
+		/// <summary>
+		/// The value currently indexed for each scope, keyed by packed handle, so that the old entry can be found when a scope changes. This and the entry containers below are standard containers,
+		/// as the engine's HashMap keeps the bucket count it was constructed with and holds each key once, and the engine has no ordered container, while lookups must stay constant or logarithmic
+		/// however large the indexed hierarchy grows.
+		/// </summary>
+		std::unordered_map<std::uint64_t, T> Values;
+		/// <summary>
+		/// The handles of the indexed scopes keyed by value, used by Hash indexes.
+		/// </summary>
+		std::unordered_multimap<T, std::uint64_t> HashEntries;
+		/// <summary>
+		/// The handles of the indexed scopes in order of value, used by Sorted indexes.
+		/// </summary>
+		std::multimap<T, std::uint64_t> SortedEntries;
+	};
+}
+
+#include "AttributeIndex.inl"
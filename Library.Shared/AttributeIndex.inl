@@ -0,0 +1,175 @@
+#include "AttributeIndex.h"
+#include <cmath>
+#include <iterator>
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	inline AttributeIndex<T>::AttributeIndex(Scope& root, std::string key, IndexKind kind) :
+		AttributeIndexBase(root, std::move(key), kind)
+	{
+	}
+
+	template <typename T>
+	inline Vector<Scope*> AttributeIndex<T>::Equal(const T& value)
+	{
+		Flush();
+		if (Kind() == IndexKind::Sorted)
+		{
+			auto [first, last] = SortedEntries.equal_range(value);
+			return Collect(first, last);
+		}
+		auto [first, last] = HashEntries.equal_range(value);
+		return Collect(first, last);
+	}
+
+	template <typename T>
+	inline Vector<Scope*> AttributeIndex<T>::Less(const T& value)
+	{
+		ThrowUnlessSorted();
+		Flush();
+		return Collect(SortedEntries.begin(), SortedEntries.lower_bound(value));
+	}
+
+	template <typename T>
+	inline Vector<Scope*> AttributeIndex<T>::Greater(const T& value)
+	{
+		ThrowUnlessSorted();
+		Flush();
+		return Collect(SortedEntries.upper_bound(value), SortedEntries.end());
+	}
+
+	template <typename T>
+	inline Vector<Scope*> AttributeIndex<T>::Between(const T& low, const T& high)
+	{
+		ThrowUnlessSorted();
+		Flush();
+		if (high < low)
+		{
+			return Vector<Scope*>();
+		}
+		return Collect(SortedEntries.lower_bound(low), SortedEntries.upper_bound(high));
+	}
+
+	template <typename T>
+	inline size_t AttributeIndex<T>::Size()
+	{
+		Flush();
+		return Values.size();
+	}
+
+	template <typename T>
+	inline void AttributeIndex<T>::Refresh(std::uint64_t handle, Scope* scope)
+	{
+		auto indexed = Values.find(handle);
+		if (indexed != Values.end())
+		{
+			auto removeEntry = [handle](auto& entries, const T& value)
+			{
+				auto [first, last] = entries.equal_range(value);
+				for (; first != last; ++first)
+				{
+					if (first->second == handle)
+					{
+						entries.erase(first);
+						return;
+					}
+				}
+			};
+			if (Kind() == IndexKind::Sorted)
+			{
+				removeEntry(SortedEntries, indexed->second);
+			}
+			else
+			{
+				removeEntry(HashEntries, indexed->second);
+			}
+			Values.erase(indexed);
+		}
+
+		T value{};
+		if (scope != nullptr && Covers(*scope) && ReadValue(*scope, value))
+		{
+			if (Kind() == IndexKind::Sorted)
+			{
+				SortedEntries.emplace(value, handle);
+			}
+			else
+			{
+				HashEntries.emplace(value, handle);
+			}
+			Values.emplace(handle, std::move(value));
+		}
+	}
+
+	template <typename T>
+	inline void AttributeIndex<T>::ThrowUnlessSorted() const
+	{
+		if (Kind() != IndexKind::Sorted)
+		{
+			throw std::runtime_error("Range queries require a sorted attribute index!");
+		}
+	}
+
+	template <typename T>
+	inline bool AttributeIndex<T>::ReadValue(const Scope& scope, T& value) const
+	{
+		const Datum* datum = scope.Find(Key());
+		if (datum == nullptr || datum->Size() == 0)
+		{
+			return false;
+		}
+
+		if constexpr (std::is_same_v<T, size_t>)
+		{
+			if (datum->Type() != Datum::DatumTypes::Integer)
+			{
+				return false;
+			}
+			value = datum->GetConstInt();
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			if (datum->Type() != Datum::DatumTypes::Float || std::isnan(datum->GetConstFloat()))
+			{
+				return false; //NaN is left out, as it has no place in the ordering of a sorted index.
+			}
+			value = datum->GetConstFloat();
+		}
+		else
+		{
+			if (datum->Type() != Datum::DatumTypes::String)
+			{
+				return false;
+			}
+			value = datum->GetStringView();
+		}
+		return true;
+	}
+
+	template <typename T>
+	template <typename Iterator>
+	inline Vector<Scope*> AttributeIndex<T>::Collect(Iterator first, Iterator last)
+	{
+		Vector<Scope*> results;
+		results.Reserve(static_cast<size_t>(std::distance(first, last)));
+		Vector<std::uint64_t> departed;
+		for (; first != last; ++first)
+		{
+			Scope* scope = Resolve(first->second);
+			if (scope != nullptr && Covers(*scope))
+			{
+				results.PushBack(scope);
+			}
+			else
+			{
+				departed.PushBack(first->second); //Destroyed or orphaned since it was indexed, and removed once the walk is done.
+			}
+		}
+		for (size_t i = 0; i < departed.Size(); i++)
+		{
+			Refresh(departed[i], nullptr);
+		}
+		return results;
+	}
+}
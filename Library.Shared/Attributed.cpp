@@ -153,4 +153,65 @@ namespace FieaGameEngine
 	{
 		return std::pair(TypeManager::Instance()->GetSignatures(TypeIdInstance()).Size() + 1, OrderTable.Size());
 	}
+
+	Attributed::AttributeView Attributed::Attributes() const
+	{
+		return ViewOf(GetAttributes());
+	}
+
+	Attributed::AttributeView Attributed::PrescribedAttributes() const
+	{
+		return ViewOf(GetPrescribedAttributes());
+	}
+
+	Attributed::AttributeView Attributed::AuxiliaryAttributes() const
+	{
+		return ViewOf(GetAuxiliaryAttributes());
+	}
+
+	Attributed::AttributeView Attributed::ViewOf(std::pair<size_t, size_t> range) const
+	{
+		if (range.first >= range.second)
+		{
+			return AttributeView();
+		}
+		PairType* const* first = &OrderTable[range.first];
+		return AttributeView(first, first + (range.second - range.first));
+	}
+
+	void Attributed::CopyAttributesFrom(AttributeView attributes)
+	{
+		const size_t prescribedEnd = GetPrescribedAttributes().second;
+		for (const PairType& attribute : attributes)
+		{
+			const auto& [key, copiedDatum] = attribute;
+			Datum* existingDatum = Find(key);
+			if (existingDatum == nullptr)
+			{
+				Append(key).AssignElements(copiedDatum);
+				continue;
+			}
+
+			if (existingDatum->Type() == copiedDatum.Type() || existingDatum->Type() == Datum::DatumTypes::Unknown)
+			{
+				existingDatum->AssignElements(copiedDatum);
+			}
+			else if (!IsPrescribed(*existingDatum, prescribedEnd))
+			{
+				*existingDatum = copiedDatum;
+			}
+		}
+	}
+
+	bool Attributed::IsPrescribed(const Datum& datum, size_t prescribedEnd) const
+	{
+		for (size_t i = 1; i < prescribedEnd; i++)
+		{
+			if (&OrderTable[i]->second == &datum)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
 }
\ No newline at end of file
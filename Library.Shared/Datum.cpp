@@ -1,9 +1,15 @@
 #include "Datum.h"
+#include "Scope.h"
+#include "HashFunctor.h"
+#include <charconv>
+#include "Simd.h"
 /// <summary>
 /// Defines functions declared for use with the Datum class.
 /// </summary>
 namespace FieaGameEngine
 {
+	Datum::GrowthPolicy Datum::Growth = Datum::DoubleCapacity;
+
 	//Base constructors
 	Datum::Datum(DatumTypes type)
 		:DataType{type}
@@ -22,12 +28,7 @@ namespace FieaGameEngine
 	//Scalar assignment operators
 	Datum& Datum::operator=(const size_t newValue)
 	{
-		if (DataType == DatumTypes::Unknown)
-		{
-			DataType = DatumTypes::Integer;
-		}
-
-		if (DataType != DatumTypes::Integer)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Integer)
 		{
 			throw std::runtime_error("Cannot set Datum as equal to one with different type!");
 		}
@@ -43,12 +44,7 @@ namespace FieaGameEngine
 
 	Datum& Datum::operator=(const float newValue)
 	{
-		if (DataType == DatumTypes::Unknown)
-		{
-			DataType = DatumTypes::Float;
-		}
-
-		if (DataType != DatumTypes::Float)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Float)
 		{
 			throw std::runtime_error("Cannot set Datum as equal to one with different type!");
 		}
@@ -64,12 +60,7 @@ namespace FieaGameEngine
 
 	Datum& Datum::operator=(const std::string& newValue)
 	{
-		if (DataType == DatumTypes::Unknown)
-		{
-			DataType = DatumTypes::String;
-		}
-
-		if (DataType != DatumTypes::String)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::String)
 		{
 			throw std::runtime_error("Cannot set Datum as equal to one with different type!");
 		}
@@ -83,14 +74,25 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	Datum& Datum::operator=(const glm::vec4 newValue)
+	Datum& Datum::operator=(std::string&& newValue)
 	{
-		if (DataType == DatumTypes::Unknown)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::String)
 		{
-			DataType = DatumTypes::Vector;
+			throw std::runtime_error("Cannot set Datum as equal to one with different type!");
 		}
 
-		if (DataType != DatumTypes::Vector)
+		if (CurrentSize > 0)
+		{
+			Clear();
+		}
+
+		PushBack(std::move(newValue));
+		return *this;
+	}
+
+	Datum& Datum::operator=(const glm::vec4 newValue)
+	{
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Vector)
 		{
 			throw std::runtime_error("Cannot set Datum as equal to one with different type!");
 		}
@@ -106,12 +108,7 @@ namespace FieaGameEngine
 
 	Datum& Datum::operator=(const glm::mat4& newValue)
 	{
-		if (DataType == DatumTypes::Unknown)
-		{
-			DataType = DatumTypes::Matrix;
-		}
-
-		if (DataType != DatumTypes::Matrix)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Matrix)
 		{
 			throw std::runtime_error("Cannot set Datum as equal to one with different type!");
 		}
@@ -127,12 +124,23 @@ namespace FieaGameEngine
 
 	Datum& Datum::operator=(RTTI* newValue)
 	{
-		if (DataType == DatumTypes::Unknown)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Pointer)
 		{
-			DataType = DatumTypes::Pointer;
+			throw std::runtime_error("Cannot set Datum as equal to one with different type!");
 		}
 
-		if (DataType != DatumTypes::Pointer)
+		if (CurrentSize > 0)
+		{
+			Clear();
+		}
+
+		PushBack(newValue);
+		return *this;
+	}
+
+	Datum& Datum::operator=(ScopeHandle newValue)
+	{
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Handle)
 		{
 			throw std::runtime_error("Cannot set Datum as equal to one with different type!");
 		}
@@ -162,42 +170,68 @@ namespace FieaGameEngine
 	{
 		if (copiedDatum.IsExternal)
 		{
-			SetStorage(DataType, copiedDatum.Data.vp, copiedDatum.Size());
+			IsExternal = true; //Set directly, as SetStorage would refuse a Datum that already has a capacity.
+			Data.vp = copiedDatum.Data.vp;
+		}
+		else if (copiedDatum.IsInline())
+		{
+			memcpy(InlineStorage, copiedDatum.InlineStorage, InlineBytes);
+			Data.vp = InlineStorage;
 		}
 		else
 		{
 			Data.vp = copiedDatum.Data.vp;
 		}
 
+		Packed = std::exchange(copiedDatum.Packed, false);
+		ElementsEscaped = copiedDatum.ElementsEscaped;
 		copiedDatum.Data.vp = nullptr;
 		copiedDatum.CurrentSize = 0;
 		copiedDatum.CurrentCapacity = 0;
 		copiedDatum.DataType = DatumTypes::Unknown;
 	}
 
-	Datum& Datum::operator=(Datum&& copiedDatum) noexcept
+	Datum& Datum::operator=(Datum&& copiedDatum)
 	{
-		if (this != &copiedDatum && &copiedDatum.Data.vp != &Data.vp)
+		if (this == &copiedDatum)
 		{
-			DataType = copiedDatum.DataType;
-			if (!IsExternal)
-			{
-				Clear();
-				ShrinkToFit();
-				Data.vp = copiedDatum.Data.vp;
-				CurrentSize = copiedDatum.CurrentSize;
-				CurrentCapacity = copiedDatum.CurrentCapacity;
-				IsExternal = copiedDatum.IsExternal;
-			}
-			else
-			{
-				SetStorage(DataType, copiedDatum.Data.vp, copiedDatum.Size());
-			}
+			return *this;
+		}
+		if (IsExternal && !copiedDatum.IsExternal)
+		{
+			AssignElements(copiedDatum); //External storage belongs to someone else, so the elements are copied into it, and the moved Datum keeps its own storage.
+			return *this;
+		}
+		if (IsExternal && DataType != copiedDatum.DataType)
+		{
+			throw std::runtime_error("Cannot change type of data after it has already been assigned!");
+		}
 
-			copiedDatum.Data.vp = nullptr;
-			copiedDatum.CurrentSize = 0;
-			copiedDatum.CurrentCapacity = 0;
+		NotifyChanged();
+		if (!IsExternal)
+		{
+			Clear();
+			ShrinkToFit();
+		}
+		DataType = copiedDatum.DataType;
+		if (copiedDatum.IsInline())
+		{
+			memcpy(InlineStorage, copiedDatum.InlineStorage, InlineBytes);
+			Data.vp = InlineStorage;
+		}
+		else
+		{
+			Data.vp = copiedDatum.Data.vp;
 		}
+		CurrentSize = copiedDatum.CurrentSize;
+		CurrentCapacity = copiedDatum.CurrentCapacity;
+		IsExternal = copiedDatum.IsExternal;
+		Packed = std::exchange(copiedDatum.Packed, false);
+		ElementsEscaped = ElementsEscaped || copiedDatum.ElementsEscaped; //References into either Datum's storage may still be written through.
+
+		copiedDatum.Data.vp = nullptr;
+		copiedDatum.CurrentSize = 0;
+		copiedDatum.CurrentCapacity = 0;
 		return *this;
 	}
 	
@@ -214,19 +248,25 @@ namespace FieaGameEngine
 		PushBack(initialValue);
 	}
 
-	Datum::Datum(std::string& initialValue)
+	Datum::Datum(const std::string& initialValue)
 	{
 		DataType = DatumTypes::String;
 		PushBack(initialValue);
 	}
 
+	Datum::Datum(std::string&& initialValue)
+	{
+		DataType = DatumTypes::String;
+		PushBack(std::move(initialValue));
+	}
+
 	Datum::Datum(glm::vec4 initialValue)
 	{
 		DataType = DatumTypes::Vector;
 		PushBack(initialValue);
 	}
 
-	Datum::Datum(glm::mat4& initialValue)
+	Datum::Datum(const glm::mat4& initialValue)
 	{
 		DataType = DatumTypes::Matrix;
 		PushBack(initialValue);
@@ -244,6 +284,12 @@ namespace FieaGameEngine
 		PushBack(initialValue);
 	}
 
+	Datum::Datum(ScopeHandle initialValue)
+	{
+		DataType = DatumTypes::Handle;
+		PushBack(initialValue);
+	}
+
 	//Provided size typecast constructors
 	Datum::Datum(size_t initialValue, size_t size)
 	{
@@ -266,6 +312,13 @@ namespace FieaGameEngine
 		PushBack(initialValue);
 	}
 
+	Datum::Datum(std::string&& initialValue, size_t size)
+	{
+		DataType = DatumTypes::String;
+		Reserve(size);
+		PushBack(std::move(initialValue));
+	}
+
 	Datum::Datum(glm::vec4 initialValue, size_t size)
 	{
 		DataType = DatumTypes::Vector;
@@ -287,6 +340,13 @@ namespace FieaGameEngine
 		PushBack(initialValue);
 	}
 
+	Datum::Datum(ScopeHandle initialValue, size_t size)
+	{
+		DataType = DatumTypes::Handle;
+		Reserve(size);
+		PushBack(initialValue);
+	}
+
 	//Datum copy constructor
 
 	Datum::Datum(const Datum& copiedDatum)
@@ -295,6 +355,7 @@ namespace FieaGameEngine
 	}
 	Datum& Datum::operator=(const Datum& copiedDatum)
 	{
+		NotifyChanged();
 		if (this != &copiedDatum)
 		{
 			if (!IsExternal && CurrentCapacity > 0)
@@ -308,71 +369,147 @@ namespace FieaGameEngine
 	}
 	bool Datum::operator==(const Datum& comparedDatum) const
 	{
-		if (!(CurrentSize == comparedDatum.CurrentSize && DataType == comparedDatum.DataType && IsExternal == comparedDatum.IsExternal))
+		if (IsExternal != comparedDatum.IsExternal)
 		{
 			return false;
 		}
+		return ElementsEqual(comparedDatum);
+	}
 
-		switch (DataType)
+	bool Datum::ElementsEqual(const Datum& comparedDatum) const
+	{
+		if (!(CurrentSize == comparedDatum.CurrentSize && DataType == comparedDatum.DataType))
 		{
-		case FieaGameEngine::Datum::DatumTypes::Integer:
-			for (size_t i = 0; i < CurrentSize; i++)
+			return false;
+		}
+		return ElementsEqual(comparedDatum, 0, CurrentSize);
+	}
+
+	bool Datum::ElementsEqual(const Datum& comparedDatum, size_t first, size_t count) const
+	{
+		assert(DataType == comparedDatum.DataType && first + count <= CurrentSize && first + count <= comparedDatum.CurrentSize);
+		if (count == 0)
+		{
+			return true;
+		}
+
+		return Dispatch(DataType, [this, &comparedDatum, first, count](auto tag)
+		{
+			using T = typename decltype(tag)::Type;
+			const T* left = static_cast<const T*>(Data.vp) + first;
+			const T* right = static_cast<const T*>(comparedDatum.Data.vp) + first;
+			if constexpr (std::is_same_v<T, std::string>)
 			{
-				if (Data.i[i] != comparedDatum.Data.i[i])
+				for (size_t i = first; i < first + count; i++)
 				{
-					return false;
+					const std::string_view leftString = GetStringView(i);
+					const std::string_view rightString = comparedDatum.GetStringView(i);
+					if (leftString.size() != rightString.size() || memcmp(leftString.data(), rightString.data(), leftString.size()) != 0)
+					{
+						return false;
+					}
 				}
+				return true;
 			}
-			break;
-		case FieaGameEngine::Datum::DatumTypes::Float:
-			for (size_t i = 0; i < CurrentSize; i++)
+			else if constexpr (std::is_same_v<T, RTTI*>)
 			{
-				if (Data.f[i] != comparedDatum.Data.f[i])
+				for (size_t i = 0; i < count; i++)
 				{
-					return false;
+					if (left[i] != right[i] && (left[i] == nullptr || !left[i]->Equals(right[i])))
+					{
+						return false;
+					}
 				}
+				return true;
 			}
-			break;
-		case FieaGameEngine::Datum::DatumTypes::String:
-			for (size_t i = 0; i < CurrentSize; i++)
+			else if constexpr (std::is_same_v<T, Scope*>)
 			{
-				if (Data.s[i] != comparedDatum.Data.s[i])
-				{
-					return false;
-				}
+				return true; //Nested scopes are compared by the scopes holding them.
 			}
-			break;
-		case FieaGameEngine::Datum::DatumTypes::Vector:
-			for (size_t i = 0; i < CurrentSize; i++)
+			else if constexpr (IsFloatElement<T>)
 			{
-				if (Data.v[i] != comparedDatum.Data.v[i])
-				{
-					return false;
-				}
+				return FloatsEqual(reinterpret_cast<const float*>(left), reinterpret_cast<const float*>(right), count * (sizeof(T) / sizeof(float)));
 			}
-			break;
-		case FieaGameEngine::Datum::DatumTypes::Matrix:
-			for (size_t i = 0; i < CurrentSize; i++)
+			else if constexpr (std::is_same_v<T, double>)
 			{
-				if (Data.m[i] != comparedDatum.Data.m[i])
-				{
-					return false;
-				}
+				return std::equal(left, left + count, right);
 			}
-			break;
-		case FieaGameEngine::Datum::DatumTypes::Pointer:
+			else
+			{
+				return memcmp(left, right, count * sizeof(T)) == 0;
+			}
+		});
+	}
+
+	std::uint64_t Datum::Hash() const
+	{
+		std::uint64_t hash = MixHash((static_cast<std::uint64_t>(DataType) << 32) ^ CurrentSize);
+		if (CurrentSize == 0)
+		{
+			return hash;
+		}
+
+		//Dispatched once, so that the loop over the elements is specialized for their type.
+		return Dispatch(DataType, [this, hash](auto tag) mutable
+		{
+			using T = typename decltype(tag)::Type;
+			const T* elements = static_cast<const T*>(Data.vp);
 			for (size_t i = 0; i < CurrentSize; i++)
 			{
-				if (Data.p[i] != nullptr)
+				if constexpr (std::is_same_v<T, std::string>)
+				{
+					hash = MixHash(hash ^ SeededStringHash{}(GetStringView(i)));
+				}
+				else if constexpr (std::is_same_v<T, RTTI*>)
+				{
+					//Pointers contribute only their count, since RTTI equality is user defined.
+				}
+				else if constexpr (std::is_same_v<T, Scope*>)
+				{
+					hash = MixHash(hash ^ elements[i]->StructuralHash());
+				}
+				else if constexpr (std::is_same_v<T, ScopeHandle>)
+				{
+					hash = MixHash(hash ^ ((static_cast<std::uint64_t>(elements[i].Generation) << 32) | elements[i].Index));
+				}
+				else if constexpr (IsFloatElement<T>)
 				{
-					if (!Data.p[i]->Equals(comparedDatum.Data.p[i]))
+					//Zero is normalized so that 0.0f and -0.0f, which compare equal, also hash equal.
+					const float* components = reinterpret_cast<const float*>(elements + i);
+					for (size_t component = 0; component < sizeof(T) / sizeof(float); component++)
 					{
-						return false;
+						std::uint32_t bits = 0;
+						if (components[component] != 0.0f)
+						{
+							memcpy(&bits, components + component, sizeof(bits));
+						}
+						hash = MixHash(hash ^ bits);
 					}
 				}
+				else if constexpr (std::is_same_v<T, double>)
+				{
+					std::uint64_t bits = 0;
+					if (elements[i] != 0.0)
+					{
+						memcpy(&bits, elements + i, sizeof(bits));
+					}
+					hash = MixHash(hash ^ bits);
+				}
+				else
+				{
+					hash = MixHash(hash ^ static_cast<std::uint64_t>(elements[i]));
+				}
 			}
+			return hash;
+		});
+	}
+
+	void Datum::NotifyChanged(size_t index)
+	{
+		if (Owner != nullptr)
+		{
+			Owner->DatumChanged(*this, index);
 		}
-		return true;
 	}
 
 	bool Datum::operator!=(const Datum& comparedDatum) const
@@ -431,7 +568,7 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot compare empty datum!");
 		}
 
-		return (Data.s[0] == comparedDatum);
+		return (GetStringView() == comparedDatum);
 	}
 
 	bool Datum::operator!=(const std::string& comparedDatum) const
@@ -502,6 +639,26 @@ namespace FieaGameEngine
 		return !(*this == comparedDatum);
 	}
 
+	bool Datum::operator==(const ScopeHandle& comparedDatum) const
+	{
+		if (DataType != DatumTypes::Handle)
+		{
+			throw std::runtime_error("Cannot compare to scalar of different type!");
+		}
+
+		if (CurrentSize == 0)
+		{
+			throw std::runtime_error("Cannot compare empty datum!");
+		}
+
+		return (Data.h[0] == comparedDatum);
+	}
+
+	bool Datum::operator!=(const ScopeHandle& comparedDatum) const
+	{
+		return !(*this == comparedDatum);
+	}
+
 	//Datum destructor
 	Datum::~Datum()
 	{
@@ -521,6 +678,7 @@ namespace FieaGameEngine
 	{
 		if (DataType == DatumTypes::Unknown)
 		{
+			NotifyChanged();
 			DataType = type;
 		}
 
@@ -546,141 +704,260 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot remove values from External container!");
 		}
+		NotifyChanged();
 
-		if (DataType == DatumTypes::String)
+		if (Packed)
 		{
-			for (size_t i = 0; i < CurrentSize; i++)
-			{
-				Data.s[i].~basic_string();
-			}
+			AlignedMemory::Free(Data.vp); //A packed block holds nothing besides its elements, so it is released along with them.
+			Data.vp = nullptr;
+			CurrentCapacity = 0;
+			Packed = false;
+		}
+		else
+		{
+			DestroyElements(0, CurrentSize);
 		}
 		CurrentSize = 0;
 	}
 
 	void Datum::ShrinkToFit()
 	{
-		if (CurrentSize == 0 && !IsExternal && CurrentCapacity > 0)
-		{
-			free(Data.vp);
-			Data.vp = nullptr;
-			CurrentCapacity = 0;
-		}
-
 		if (CurrentCapacity > CurrentSize && !IsExternal)
 		{
-			void* data = nullptr;
-			data = realloc(Data.vp, TypeSize[static_cast<size_t>(DataType)] * CurrentSize);
-			assert(data != nullptr);
-			Data.vp = data;
+			Reallocate(CurrentSize);
 		}
 	}
 
-	//PushBack functions
-	void Datum::PushBack(size_t newElement)
+	void Datum::Pack()
 	{
-		if (DataType != DatumTypes::Integer && DataType != DatumTypes::Unknown)
+		if (DataType != DatumTypes::String)
 		{
-			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+			throw std::runtime_error("Only String datums may be packed!");
+		}
+		if (IsExternal)
+		{
+			throw std::runtime_error("Cannot pack externally managed data!");
+		}
+		if (Packed || CurrentSize == 0)
+		{
+			return;
 		}
 
-		if (DataType == DatumTypes::Unknown)
+		size_t characters = 0;
+		for (size_t i = 0; i < CurrentSize; i++)
 		{
-			DataType = DatumTypes::Integer;
+			characters += Data.s[i].size();
 		}
 
-		if (CurrentCapacity == CurrentSize)
+		std::byte* block = AllocatePacked(CurrentSize, characters);
+		PackedString* elements = reinterpret_cast<PackedString*>(block);
+		char* destination = reinterpret_cast<char*>(block + (CurrentSize * sizeof(PackedString)));
+		size_t offset = 0;
+		for (size_t i = 0; i < CurrentSize; i++)
 		{
-			if (IsExternal)
-			{
-				throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
-			}
-			Reserve(CurrentCapacity + 1);
+			const std::string& element = Data.s[i];
+			elements[i] = PackedString{ offset, element.size() };
+			memcpy(destination + offset, element.data(), element.size());
+			offset += element.size();
+			Data.s[i].~basic_string();
 		}
-		Data.i[CurrentSize] = newElement;
-		CurrentSize++;
+
+		Reallocate(0);
+		Data.vp = block;
+		CurrentCapacity = CurrentSize;
+		Packed = true;
 	}
 
-	void Datum::PushBack(float newElement)
+	void Datum::Unpack()
 	{
-		if (DataType != DatumTypes::Float && DataType != DatumTypes::Unknown)
+		if (!Packed)
 		{
-			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+			return;
 		}
 
-		if (DataType == DatumTypes::Unknown)
+		std::string* strings = static_cast<std::string*>(AlignedMemory::Allocate(CurrentSize * sizeof(std::string), TypeAlignment[static_cast<size_t>(DatumTypes::String)]));
+		assert(strings != nullptr);
+		for (size_t i = 0; i < CurrentSize; i++)
 		{
-			DataType = DatumTypes::Float;
+			new(strings + i) std::string(GetStringView(i));
 		}
 
-		if (CurrentCapacity == CurrentSize)
-		{
-			if (IsExternal)
-			{
-				throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
-			}
-			Reserve(CurrentCapacity + 1);
-		}
+		AlignedMemory::Free(Data.vp);
+		Data.s = strings;
+		CurrentCapacity = CurrentSize;
+		Packed = false;
+	}
 
-		Data.f[CurrentSize] = newElement;
-		CurrentSize++;
+	bool Datum::IsPacked() const
+	{
+		return Packed;
 	}
 
-	void Datum::PushBack(const std::string& newElement)
+	void Datum::SetPacked(gsl::span<const std::string_view> values)
 	{
 		if (DataType != DatumTypes::String && DataType != DatumTypes::Unknown)
 		{
 			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
 		}
-
-		if (DataType == DatumTypes::Unknown)
+		if (IsExternal)
 		{
-			DataType = DatumTypes::String;
+			throw std::runtime_error("Cannot pack externally managed data!");
 		}
 
-		if (CurrentCapacity == CurrentSize)
+		DataType = DatumTypes::String;
+		Clear();
+		ShrinkToFit();
+		if (values.empty())
 		{
-			if (IsExternal)
-			{
-				throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
-			}
-			Reserve(CurrentCapacity + 1);
+			return;
 		}
-		
-		new(Data.s + CurrentSize)std::string(newElement);
-		CurrentSize++;
-	}
 
-	void Datum::PushBack(glm::vec4 newElement)
-	{
-		if (DataType != DatumTypes::Vector && DataType != DatumTypes::Unknown)
+		size_t characters = 0;
+		for (const std::string_view value : values)
 		{
-			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+			characters += value.size();
 		}
 
-		if (DataType == DatumTypes::Unknown)
+		std::byte* block = AllocatePacked(values.size(), characters);
+		PackedString* elements = reinterpret_cast<PackedString*>(block);
+		char* destination = reinterpret_cast<char*>(block + (values.size() * sizeof(PackedString)));
+		size_t offset = 0;
+		for (size_t i = 0; i < values.size(); i++)
 		{
-			DataType = DatumTypes::Vector;
+			elements[i] = PackedString{ offset, values[i].size() };
+			memcpy(destination + offset, values[i].data(), values[i].size());
+			offset += values[i].size();
 		}
 
-		if (CurrentCapacity == CurrentSize)
-		{
-			if (IsExternal)
-			{
-				throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
-			}
-			Reserve(CurrentCapacity + 1);
-		}
-		Data.v[CurrentSize] = newElement;
-		CurrentSize++;
+		Data.vp = block;
+		CurrentSize = values.size();
+		CurrentCapacity = CurrentSize;
+		Packed = true;
 	}
 
-	void Datum::PushBack(const glm::mat4& newElement)
+	std::byte* Datum::AllocatePacked(size_t count, size_t characters)
 	{
-		if (DataType != DatumTypes::Matrix && DataType != DatumTypes::Unknown)
-		{
+		std::byte* block = static_cast<std::byte*>(AlignedMemory::Allocate((count * sizeof(PackedString)) + characters, AlignedMemory::AlignmentOf<PackedString>()));
+		assert(block != nullptr);
+		return block;
+	}
+
+	const char* Datum::PackedCharacters() const
+	{
+		return reinterpret_cast<const char*>(Data.ps + CurrentSize);
+	}
+
+	size_t Datum::PackedBytes() const
+	{
+		const PackedString& last = Data.ps[CurrentSize - 1];
+		return (CurrentSize * sizeof(PackedString)) + last.Offset + last.Length;
+	}
+
+	//PushBack functions
+	void Datum::PushBack(size_t newElement)
+	{
+		if (DataType != DatumTypes::Integer && DataType != DatumTypes::Unknown)
+		{
+			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+		}
+
+		if (CurrentCapacity == CurrentSize && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
+		}
+		NotifyChanged(CurrentSize);
+
+		if (DataType == DatumTypes::Unknown)
+		{
+			DataType = DatumTypes::Integer;
+		}
+
+		if (CurrentCapacity == CurrentSize)
+		{
+			Reserve(GrownCapacity());
+		}
+		Data.i[CurrentSize] = newElement;
+		CurrentSize++;
+	}
+
+	void Datum::PushBack(float newElement)
+	{
+		if (DataType != DatumTypes::Float && DataType != DatumTypes::Unknown)
+		{
+			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+		}
+
+		if (CurrentCapacity == CurrentSize && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
+		}
+		NotifyChanged(CurrentSize);
+
+		if (DataType == DatumTypes::Unknown)
+		{
+			DataType = DatumTypes::Float;
+		}
+
+		if (CurrentCapacity == CurrentSize)
+		{
+			Reserve(GrownCapacity());
+		}
+
+		Data.f[CurrentSize] = newElement;
+		CurrentSize++;
+	}
+
+	void Datum::PushBack(const std::string& newElement)
+	{
+		new(PreparePushBack(DatumTypes::String)) std::string(newElement);
+		CurrentSize++;
+	}
+
+	void Datum::PushBack(std::string&& newElement)
+	{
+		new(PreparePushBack(DatumTypes::String)) std::string(std::move(newElement));
+		CurrentSize++;
+	}
+
+	void Datum::PushBack(glm::vec4 newElement)
+	{
+		if (DataType != DatumTypes::Vector && DataType != DatumTypes::Unknown)
+		{
+			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+		}
+
+		if (CurrentCapacity == CurrentSize && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
+		}
+		NotifyChanged(CurrentSize);
+
+		if (DataType == DatumTypes::Unknown)
+		{
+			DataType = DatumTypes::Vector;
+		}
+
+		if (CurrentCapacity == CurrentSize)
+		{
+			Reserve(GrownCapacity());
+		}
+		Data.v[CurrentSize] = newElement;
+		CurrentSize++;
+	}
+
+	void Datum::PushBack(const glm::mat4& newElement)
+	{
+		if (DataType != DatumTypes::Matrix && DataType != DatumTypes::Unknown)
+		{
 			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
 		}
 
+		if (CurrentCapacity == CurrentSize && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
+		}
+		NotifyChanged(CurrentSize);
+
 		if (DataType == DatumTypes::Unknown)
 		{
 			DataType = DatumTypes::Matrix;
@@ -688,11 +965,7 @@ namespace FieaGameEngine
 
 		if (CurrentCapacity == CurrentSize)
 		{
-			if (IsExternal)
-			{
-				throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
-			}
-			Reserve(CurrentCapacity + 1);
+			Reserve(GrownCapacity());
 		}
 		Data.m[CurrentSize] = newElement;
 		CurrentSize++;
@@ -705,6 +978,12 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
 		}
 
+		if (CurrentCapacity == CurrentSize && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
+		}
+		NotifyChanged(CurrentSize);
+
 		if (DataType == DatumTypes::Unknown)
 		{
 			DataType = DatumTypes::Pointer;
@@ -712,11 +991,7 @@ namespace FieaGameEngine
 
 		if (CurrentCapacity == CurrentSize)
 		{
-			if (IsExternal)
-			{
-				throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
-			}
-			Reserve(CurrentCapacity + 1);
+			Reserve(GrownCapacity());
 		}
 		Data.p[CurrentSize] = newElement;
 		CurrentSize++;
@@ -729,6 +1004,12 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
 		}
 
+		if (CurrentCapacity == CurrentSize && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
+		}
+		NotifyChanged(CurrentSize);
+
 		if (DataType == DatumTypes::Unknown)
 		{
 			DataType = DatumTypes::Table;
@@ -736,16 +1017,38 @@ namespace FieaGameEngine
 
 		if (CurrentCapacity == CurrentSize)
 		{
-			if (IsExternal)
-			{
-				throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
-			}
-			Reserve(CurrentCapacity + 1);
+			Reserve(GrownCapacity());
 		}
 		Data.t[CurrentSize] = &(*newElement);
 		CurrentSize++;
 	}
 
+	void Datum::PushBack(ScopeHandle newElement)
+	{
+		if (DataType != DatumTypes::Handle && DataType != DatumTypes::Unknown)
+		{
+			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+		}
+
+		if (CurrentCapacity == CurrentSize && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!"); //Cannot push new value onto back since this memory is not owned by Datum
+		}
+		NotifyChanged(CurrentSize);
+
+		if (DataType == DatumTypes::Unknown)
+		{
+			DataType = DatumTypes::Handle;
+		}
+
+		if (CurrentCapacity == CurrentSize)
+		{
+			Reserve(GrownCapacity());
+		}
+		Data.h[CurrentSize] = newElement;
+		CurrentSize++;
+	}
+
 	void Datum::PopBack()
 	{
 		if (CurrentSize <= 0)
@@ -757,11 +1060,10 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot remove values from External container!");
 		}
+		NotifyChanged(CurrentSize - 1);
+		Unpack();
 
-		if (DataType == Datum::DatumTypes::String)
-		{
-			Data.s[CurrentSize-1].~basic_string();
-		}
+		DestroyElements(CurrentSize - 1, CurrentSize);
 		CurrentSize--;
 	}
 
@@ -796,14 +1098,14 @@ namespace FieaGameEngine
 		SetStorage(DatumTypes::Pointer, elementArray, elements);
 	}
 
-	void Datum::SetStorage(DatumTypes type, void* array, size_t size)
+	void Datum::SetStorage(ScopeHandle* elementArray, size_t elements)
 	{
-		if (DataType == DatumTypes::Unknown)
-		{
-			DataType = type;
-		}
+		SetStorage(DatumTypes::Handle, elementArray, elements);
+	}
 
-		else if (DataType != type)
+	void Datum::SetStorage(DatumTypes type, void* array, size_t size)
+	{
+		if (DataType != DatumTypes::Unknown && DataType != type)
 		{
 			throw std::runtime_error("Cannot change type of data after it has already been assigned!");
 		}
@@ -812,6 +1114,8 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot change to external storage after values have been assigned internally!");
 		}
+		NotifyChanged();
+		DataType = type;
 
 		if (IsExternal)
 		{
@@ -836,58 +1140,18 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Type must be specified!");
 		}
+		Unpack();
 
-		if (newSize < 0 || newSize == CurrentCapacity)
+		if (newSize == CurrentSize && newSize == CurrentCapacity)
 		{
 			return;
 		}
+		NotifyChanged();
 
-		void* newData;
-
-		if (CurrentCapacity > newSize && DataType == DatumTypes::String)// && DataType == DatumTypes::String) ///Clear the strings if they are populating it
-		{
-			for (size_t i = CurrentSize - 1; i >= newSize; i--)
-			{
-				(Data.s + i)->~basic_string();
-			}
-		}
-
-		if (CurrentCapacity == 0)
-		{
-			newData = malloc(newSize * TypeSize[static_cast<size_t>(DataType)]);
-			assert(newData != nullptr);
-			Data.vp = newData;
-
-			switch (DataType)
-			{
-			case FieaGameEngine::Datum::DatumTypes::String:
-				for (size_t i = 0; i < newSize; i++)
-				{
-					new(Data.s + i)std::string();
-				}
-				break;
-			default:
-				memset(Data.vp, 0, newSize * TypeSize[static_cast<size_t>(DataType)]);
-				break;
-			}
-		}
-
-		else
-		{
-			newData = realloc(Data.vp, newSize * TypeSize[static_cast<size_t>(DataType)]);
-			assert(newData != nullptr);
-			Data.vp = newData;
-
-			if (DataType == DatumTypes::String && CurrentCapacity < newSize)
-			{
-				for (size_t i = CurrentSize; i < newSize; i++)
-				{
-					new(Data.s + i)std::string();
-				}
-			}
-		}
+		DestroyElements(newSize, CurrentSize); //Elements beyond the new size are destroyed before their memory is released.
+		Reallocate(newSize);
+		ConstructElements(CurrentSize, newSize); //Every element past the old size is new, including those that were already within the old capacity.
 		CurrentSize = newSize;
-		CurrentCapacity = newSize;
 	}
 
 	//Front functions
@@ -1113,13 +1377,14 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot set value at index that exceeds array size!");
 		}
-		if (DataType == DatumTypes::Unknown)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Integer)
 		{
-			DataType = DatumTypes::Integer;
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
-		if (DataType != DatumTypes::Integer)
+		NotifyChanged(index);
+		if (DataType == DatumTypes::Unknown)
 		{
-			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+			DataType = DatumTypes::Integer;
 		}
 		Data.i[index] = value;
 	}
@@ -1130,32 +1395,54 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot set value at index that exceeds array size!");
 		}
-		if (DataType == DatumTypes::Unknown)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Float)
 		{
-			DataType = DatumTypes::Float;
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
-		if (DataType != DatumTypes::Float)
+		NotifyChanged(index);
+		if (DataType == DatumTypes::Unknown)
 		{
-			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+			DataType = DatumTypes::Float;
 		}
 		Data.f[index] = value;
 	}
 
-	void Datum::SetString(std::string& value, size_t index)
+	void Datum::SetString(const std::string& value, size_t index)
 	{
 		if (index >= CurrentSize)
 		{
 			throw std::runtime_error("Cannot set value at index that exceeds array size!");
 		}
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::String)
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+		NotifyChanged(index);
 		if (DataType == DatumTypes::Unknown)
 		{
 			DataType = DatumTypes::String;
 		}
-		if (DataType != DatumTypes::String)
+		Unpack();
+		Data.s[index] = value;
+	}
+
+	void Datum::SetString(std::string&& value, size_t index)
+	{
+		if (index >= CurrentSize)
+		{
+			throw std::runtime_error("Cannot set value at index that exceeds array size!");
+		}
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::String)
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
-		Data.s[index] = value;
+		NotifyChanged(index);
+		if (DataType == DatumTypes::Unknown)
+		{
+			DataType = DatumTypes::String;
+		}
+		Unpack();
+		Data.s[index] = std::move(value);
 	}
 
 	void Datum::SetVector(glm::vec4 value, size_t index)
@@ -1164,30 +1451,32 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot set value at index that exceeds array size!");
 		}
-		if (DataType == DatumTypes::Unknown)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Vector)
 		{
-			DataType = DatumTypes::Vector;
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
-		if (DataType != DatumTypes::Vector)
+		NotifyChanged(index);
+		if (DataType == DatumTypes::Unknown)
 		{
-			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+			DataType = DatumTypes::Vector;
 		}
 		Data.v[index] = value;
 	}
 
-	void Datum::SetMatrix(glm::mat4& value, size_t index)
+	void Datum::SetMatrix(const glm::mat4& value, size_t index)
 	{
 		if (index >= CurrentSize)
 		{
 			throw std::runtime_error("Cannot set value at index that exceeds array size!");
 		}
-		if (DataType == DatumTypes::Unknown)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Matrix)
 		{
-			DataType = DatumTypes::Matrix;
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
-		if (DataType != DatumTypes::Matrix)
+		NotifyChanged(index);
+		if (DataType == DatumTypes::Unknown)
 		{
-			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+			DataType = DatumTypes::Matrix;
 		}
 		Data.m[index] = value;
 	}
@@ -1198,15 +1487,34 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot set value at index that exceeds array size!");
 		}
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Pointer)
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+		NotifyChanged(index);
 		if (DataType == DatumTypes::Unknown)
 		{
 			DataType = DatumTypes::Pointer;
 		}
-		if (DataType != DatumTypes::Pointer)
+		Data.p[index] = value;
+	}
+
+	void Datum::SetHandle(ScopeHandle value, size_t index)
+	{
+		if (index >= CurrentSize)
+		{
+			throw std::runtime_error("Cannot set value at index that exceeds array size!");
+		}
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Handle)
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
-		Data.p[index] = value;
+		NotifyChanged(index);
+		if (DataType == DatumTypes::Unknown)
+		{
+			DataType = DatumTypes::Handle;
+		}
+		Data.h[index] = value;
 	}
 
 	void Datum::SetScope(Scope* value, size_t index)
@@ -1215,13 +1523,14 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot set value at index that exceeds array size!");
 		}
-		if (DataType == DatumTypes::Unknown)
+		if (DataType != DatumTypes::Unknown && DataType != DatumTypes::Table)
 		{
-			DataType = DatumTypes::Table;
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
-		if (DataType != DatumTypes::Table)
+		NotifyChanged(index);
+		if (DataType == DatumTypes::Unknown)
 		{
-			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+			DataType = DatumTypes::Table;
 		}
 		Data.t[index] = value;
 	}
@@ -1236,6 +1545,8 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		NotifyChanged(index);
+		ElementsEscaped = true;
 		return Data.i[index];
 	}
 
@@ -1249,6 +1560,8 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		NotifyChanged(index);
+		ElementsEscaped = true;
 		return Data.f[index];
 	}
 
@@ -1262,6 +1575,9 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		NotifyChanged(index);
+		Unpack();
+		ElementsEscaped = true;
 		return Data.s[index];
 	}
 
@@ -1275,6 +1591,8 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		NotifyChanged(index);
+		ElementsEscaped = true;
 		return Data.v[index];
 	}
 
@@ -1288,6 +1606,8 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		NotifyChanged(index);
+		ElementsEscaped = true;
 		return Data.m[index];
 	}
 
@@ -1301,9 +1621,25 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		NotifyChanged(index);
 		return Data.p[index];
 	}
 
+	ScopeHandle& Datum::GetHandle(size_t index)
+	{
+		if (index >= CurrentSize)
+		{
+			throw std::runtime_error("Cannot access value at index that exceeds array size!");
+		}
+		if (DataType != DatumTypes::Handle)
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+		NotifyChanged(index);
+		ElementsEscaped = true;
+		return Data.h[index];
+	}
+
 	Scope*& Datum::GetScope(size_t index)
 	{
 		if (index >= CurrentSize)
@@ -1314,6 +1650,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		NotifyChanged(index);
 		return Data.t[index];
 	}
 
@@ -1355,10 +1692,32 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		if (Packed)
+		{
+			throw std::runtime_error("Packed string datums must be read with GetStringView!");
+		}
 		const std::string& newValue = Data.s[index];
 		return newValue;
 	}
 
+	std::string_view Datum::GetStringView(size_t index) const
+	{
+		if (index >= CurrentSize)
+		{
+			throw std::runtime_error("Cannot access value at index that exceeds array size!");
+		}
+		if (DataType != DatumTypes::String)
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+		if (Packed)
+		{
+			const PackedString& element = Data.ps[index];
+			return std::string_view(PackedCharacters() + element.Offset, element.Length);
+		}
+		return Data.s[index];
+	}
+
 	const glm::vec4 Datum::GetConstVector(size_t index) const
 	{
 		if (index >= CurrentSize)
@@ -1400,34 +1759,59 @@ namespace FieaGameEngine
 		return Data.p[index];
 	}
 
-	Scope*const& Datum::GetConstScope(size_t index) const
+	const ScopeHandle& Datum::GetConstHandle(size_t index) const
 	{
 		if (index >= CurrentSize)
 		{
-			throw std::runtime_error("Cannot set value at index that exceeds array size!");
+			throw std::runtime_error("Cannot access value at index that exceeds array size!");
 		}
-		if (DataType != DatumTypes::Table)
+		if (DataType != DatumTypes::Handle)
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
-		return Data.t[index];
+		return Data.h[index];
 	}
 
-	size_t Datum::Find(const size_t value) const
+	Scope* Datum::ResolveHandle(size_t index) const
 	{
-		if (DataType != DatumTypes::Integer)
-		{
+		return ScopeHandleTable::Resolve(GetConstHandle(index));
+	}
+
+	Scope*const& Datum::GetConstScope(size_t index) const
+	{
+		if (index >= CurrentSize)
+		{
+			throw std::runtime_error("Cannot set value at index that exceeds array size!");
+		}
+		if (DataType != DatumTypes::Table)
+		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
+		return Data.t[index];
+	}
 
-		for (size_t position = 0; position < CurrentSize; ++position)
+	size_t Datum::Find(const size_t value) const
+	{
+		if (DataType != DatumTypes::Integer)
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+
+		if constexpr (sizeof(size_t) == sizeof(std::uint64_t))
+		{
+			return FindWords(Data.vp, CurrentSize, value);
+		}
+		else
 		{
-			if (Data.i[position] == value)
+			for (size_t position = 0; position < CurrentSize; ++position)
 			{
-				return position;
+				if (Data.i[position] == value)
+				{
+					return position;
+				}
 			}
+			return CurrentSize;
 		}
-		return CurrentSize;
 	}
 
 	size_t Datum::Find(const float value) const
@@ -1437,14 +1821,7 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
 
-		for (size_t position = 0; position < CurrentSize; ++position)
-		{
-			if (Data.f[position] == value)
-			{
-				return position;
-			}
-		}
-		return CurrentSize;
+		return FindFloats(Data.f, CurrentSize, &value, 1);
 	}
 
 	void Datum::Reserve(size_t size)
@@ -1463,19 +1840,257 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot reserve space for unknown type!");
 		}
+		Unpack();
+
+		Reallocate(size);
+	}
+
+	bool Datum::IsInline() const
+	{
+		return Data.vp == static_cast<const void*>(InlineStorage);
+	}
+
+	size_t Datum::InlineCapacity(DatumTypes type)
+	{
+		if (type == DatumTypes::Unknown || type == DatumTypes::String)
+		{
+			return 0;
+		}
+		return InlineBytes / TypeSize[static_cast<size_t>(type)];
+	}
+
+	void Datum::Reallocate(size_t capacity)
+	{
+		const size_t typeSize = TypeSize[static_cast<size_t>(DataType)];
+		const size_t keptBytes = std::min(CurrentSize, capacity) * typeSize;
+		const size_t inlineCapacity = InlineCapacity(DataType);
 
-		void* newData;
-		if (CurrentCapacity == 0)
+		if (capacity == 0)
+		{
+			if (!IsInline())
+			{
+				AlignedMemory::Free(Data.vp);
+			}
+			Data.vp = nullptr;
+			CurrentCapacity = 0;
+		}
+		else if (capacity <= inlineCapacity)
 		{
-			newData = malloc(size * TypeSize[static_cast<size_t>(DataType)]);
+			if (!IsInline())
+			{
+				if (keptBytes > 0)
+				{
+					memcpy(InlineStorage, Data.vp, keptBytes);
+				}
+				AlignedMemory::Free(Data.vp);
+				Data.vp = InlineStorage;
+			}
+			CurrentCapacity = inlineCapacity;
 		}
 		else
 		{
-			newData = realloc(Data.vp, size * TypeSize[static_cast<size_t>(DataType)]);
+			void* newData;
+			if (IsInline())
+			{
+				newData = AlignedMemory::Allocate(capacity * typeSize, TypeAlignment[static_cast<size_t>(DataType)]);
+				assert(newData != nullptr);
+				memcpy(newData, InlineStorage, keptBytes);
+			}
+			else
+			{
+				const size_t alignment = TypeAlignment[static_cast<size_t>(DataType)];
+				newData = Dispatch(DataType, [this, capacity, keptBytes, alignment](auto tag)
+				{
+					using T = typename decltype(tag)::Type;
+					if constexpr (std::is_trivially_copyable_v<T>)
+					{
+						return AlignedMemory::Reallocate(Data.vp, keptBytes, capacity * sizeof(T), alignment); //Behaves as Allocate when nothing has been allocated yet.
+					}
+					else
+					{
+						//The block may move, so elements that may point into themselves, such as short strings, are move constructed into place rather than copied bytewise.
+						T* elements = static_cast<T*>(AlignedMemory::Allocate(capacity * sizeof(T), alignment));
+						assert(elements != nullptr);
+						T* oldElements = static_cast<T*>(Data.vp);
+						const size_t kept = keptBytes / sizeof(T);
+						std::uninitialized_move(oldElements, oldElements + kept, elements);
+						std::destroy(oldElements, oldElements + kept);
+						AlignedMemory::Free(Data.vp);
+						return static_cast<void*>(elements);
+					}
+				});
+				assert(newData != nullptr);
+			}
+			Data.vp = newData;
+			CurrentCapacity = capacity;
+		}
+	}
+
+	void Datum::DestroyElements(size_t first, size_t last)
+	{
+		if (first >= last || DataType == DatumTypes::Unknown)
+		{
+			return;
 		}
-		assert(newData != nullptr);
-		Data.vp = newData;
-		CurrentCapacity = size;
+		Dispatch(DataType, [this, first, last](auto tag)
+		{
+			using T = typename decltype(tag)::Type;
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				std::destroy(static_cast<T*>(Data.vp) + first, static_cast<T*>(Data.vp) + last);
+			}
+		});
+	}
+
+	void Datum::ConstructElements(size_t first, size_t last)
+	{
+		if (first >= last || DataType == DatumTypes::Unknown)
+		{
+			return;
+		}
+		Dispatch(DataType, [this, first, last](auto tag)
+		{
+			using T = typename decltype(tag)::Type;
+			T* elements = static_cast<T*>(Data.vp);
+			if constexpr (std::is_same_v<T, glm::quat>)
+			{
+				std::fill(elements + first, elements + last, glm::quat(1.0f, 0.0f, 0.0f, 0.0f)); //A zeroed quaternion is not a rotation, so new elements start out as the identity instead.
+			}
+			else if constexpr (std::is_same_v<T, glm::mat4x3>)
+			{
+				std::fill(elements + first, elements + last, glm::mat4x3(1.0f)); //Likewise, a zeroed transform collapses every point onto the origin.
+			}
+			else if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				memset(elements + first, 0, (last - first) * sizeof(T)); //Zero is a null pointer or handle, and zero in every numeric type.
+			}
+			else
+			{
+				std::uninitialized_value_construct(elements + first, elements + last);
+			}
+		});
+	}
+
+	size_t Datum::DoubleCapacity(size_t capacity)
+	{
+		return capacity < 4 ? 4 : capacity * 2;
+	}
+
+	void Datum::SetGrowthPolicy(GrowthPolicy policy)
+	{
+		Growth = policy != nullptr ? policy : DoubleCapacity;
+	}
+
+	Datum::GrowthPolicy Datum::GetGrowthPolicy()
+	{
+		return Growth;
+	}
+
+	size_t Datum::GrownCapacity() const
+	{
+		if (CurrentCapacity < InlineCapacity(DataType))
+		{
+			return InlineCapacity(DataType); //Fill the inline storage before the growth policy allocates anything.
+		}
+		return std::max(Growth(CurrentCapacity), CurrentCapacity + 1);
+	}
+
+	std::byte* Datum::PrepareAppend(DatumTypes type, size_t count)
+	{
+		if (DataType != type && DataType != DatumTypes::Unknown)
+		{
+			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+		}
+
+		if (CurrentSize + count > CurrentCapacity && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!");
+		}
+		NotifyChanged();
+
+		if (DataType == DatumTypes::Unknown)
+		{
+			DataType = type;
+		}
+		Unpack();
+
+		if (CurrentSize + count > CurrentCapacity)
+		{
+			Reserve(CurrentSize + count); //Sized exactly, as the caller knows how many elements it is adding.
+		}
+		return static_cast<std::byte*>(Data.vp) + (CurrentSize * TypeSize[static_cast<size_t>(DataType)]);
+	}
+
+	std::byte* Datum::PreparePushBack(DatumTypes type)
+	{
+		if (DataType != type && DataType != DatumTypes::Unknown)
+		{
+			throw std::runtime_error("Cannot add object type that is not the same as the container's type!");
+		}
+
+		if (CurrentCapacity == CurrentSize && IsExternal)
+		{
+			throw std::runtime_error("Cannot exceed size of external container!");
+		}
+		NotifyChanged(CurrentSize);
+
+		if (DataType == DatumTypes::Unknown)
+		{
+			DataType = type;
+		}
+		Unpack();
+
+		if (CurrentCapacity == CurrentSize)
+		{
+			Reserve(GrownCapacity());
+		}
+		return static_cast<std::byte*>(Data.vp) + (CurrentSize * TypeSize[static_cast<size_t>(DataType)]);
+	}
+
+	void Datum::Append(gsl::span<const size_t> values)
+	{
+		memcpy(PrepareAppend(DatumTypes::Integer, values.size()), values.data(), values.size_bytes());
+		CurrentSize += values.size();
+	}
+
+	void Datum::Append(gsl::span<const float> values)
+	{
+		memcpy(PrepareAppend(DatumTypes::Float, values.size()), values.data(), values.size_bytes());
+		CurrentSize += values.size();
+	}
+
+	void Datum::Append(gsl::span<const std::string> values)
+	{
+		std::string* destination = reinterpret_cast<std::string*>(PrepareAppend(DatumTypes::String, values.size()));
+		for (const std::string& value : values)
+		{
+			new(destination++)std::string(value);
+			CurrentSize++; //Counted as each is constructed, so that a throwing copy leaves the Datum consistent.
+		}
+	}
+
+	void Datum::Append(gsl::span<const glm::vec4> values)
+	{
+		memcpy(PrepareAppend(DatumTypes::Vector, values.size()), values.data(), values.size_bytes());
+		CurrentSize += values.size();
+	}
+
+	void Datum::Append(gsl::span<const glm::mat4> values)
+	{
+		memcpy(PrepareAppend(DatumTypes::Matrix, values.size()), values.data(), values.size_bytes());
+		CurrentSize += values.size();
+	}
+
+	void Datum::Append(gsl::span<RTTI* const> values)
+	{
+		memcpy(PrepareAppend(DatumTypes::Pointer, values.size()), values.data(), values.size_bytes());
+		CurrentSize += values.size();
+	}
+
+	void Datum::Append(gsl::span<const ScopeHandle> values)
+	{
+		memcpy(PrepareAppend(DatumTypes::Handle, values.size()), values.data(), values.size_bytes());
+		CurrentSize += values.size();
 	}
 
 	size_t Datum::Find(const std::string& value) const
@@ -1487,7 +2102,8 @@ namespace FieaGameEngine
 
 		for (size_t position = 0; position < CurrentSize; ++position)
 		{
-			if (Data.s[position] == value)
+			const std::string_view element = GetStringView(position);
+			if (element.size() == value.size() && memcmp(element.data(), value.data(), value.size()) == 0)
 			{
 				return position;
 			}
@@ -1502,9 +2118,29 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
 
+		return FindFloats(Data.f, CurrentSize, reinterpret_cast<const float*>(&value), 4);
+	}
+
+	size_t Datum::Find(const glm::mat4& value) const
+	{
+		if (DataType != DatumTypes::Matrix)
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+
+		return FindFloats(Data.f, CurrentSize, reinterpret_cast<const float*>(&value), 16);
+	}
+
+	size_t Datum::Find(RTTI* value) const
+	{
+		if (DataType != DatumTypes::Pointer)
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+
 		for (size_t position = 0; position < CurrentSize; ++position)
 		{
-			if (Data.v[position] == value)
+			if (Data.p[position]->Equals(value))
 			{
 				return position;
 			}
@@ -1512,38 +2148,148 @@ namespace FieaGameEngine
 		return CurrentSize;
 	}
 
-	size_t Datum::Find(const glm::mat4& value) const
+	size_t Datum::Find(ScopeHandle value) const
 	{
-		if (DataType != DatumTypes::Matrix)
+		if (DataType != DatumTypes::Handle)
 		{
 			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
 		}
 
-		for (size_t position = 0; position < CurrentSize; ++position)
+		std::uint64_t word;
+		memcpy(&word, &value, sizeof(word));
+		return FindWords(Data.vp, CurrentSize, word);
+	}
+
+	bool Datum::FloatsEqual(const float* left, const float* right, size_t count)
+	{
+		size_t i = 0;
+#if defined(FIEA_SIMD_AVX2)
+		for (; i + 8 <= count; i += 8)
 		{
-			if (Data.m[position] == value)
+			if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(left + i), _mm256_loadu_ps(right + i), _CMP_EQ_OQ)) != 0xFF)
 			{
-				return position;
+				return false;
 			}
 		}
-		return CurrentSize;
+#endif
+#if defined(FIEA_SIMD_AVX2) || defined(FIEA_SIMD_SSE2)
+		for (; i + 4 <= count; i += 4)
+		{
+			if (_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(left + i), _mm_loadu_ps(right + i))) != 0xF)
+			{
+				return false;
+			}
+		}
+#endif
+		for (; i < count; i++)
+		{
+			if (left[i] != right[i])
+			{
+				return false;
+			}
+		}
+		return true;
 	}
 
-	size_t Datum::Find(RTTI* value) const
+	size_t Datum::FindFloats(const float* elements, size_t count, const float* value, size_t components)
 	{
-		if (DataType != DatumTypes::Pointer)
+		if (components > 1)
 		{
-			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+			//Each Vector or Matrix is compared a register at a time, as its components fill whole registers.
+			for (size_t i = 0; i < count; i++)
+			{
+				if (FloatsEqual(elements + (i * components), value, components))
+				{
+					return i;
+				}
+			}
+			return count;
 		}
 
-		for (size_t position = 0; position < CurrentSize; ++position)
+		size_t i = 0;
+#if defined(FIEA_SIMD_AVX2)
+		const __m256 wide = _mm256_set1_ps(*value);
+		for (; i + 8 <= count; i += 8)
 		{
-			if (Data.p[position]->Equals(value))
+			const int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(elements + i), wide, _CMP_EQ_OQ));
+			if (mask != 0)
 			{
-				return position;
+				return i + LowestSetBit(mask);
 			}
 		}
-		return CurrentSize;
+#endif
+#if defined(FIEA_SIMD_AVX2) || defined(FIEA_SIMD_SSE2)
+		const __m128 narrow = _mm_set1_ps(*value);
+		for (; i + 4 <= count; i += 4)
+		{
+			const int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(elements + i), narrow));
+			if (mask != 0)
+			{
+				return i + LowestSetBit(mask);
+			}
+		}
+#endif
+		for (; i < count; i++)
+		{
+			if (elements[i] == *value)
+			{
+				return i;
+			}
+		}
+		return count;
+	}
+
+	size_t Datum::FindWords(const void* words, size_t count, std::uint64_t value)
+	{
+		const std::byte* bytes = static_cast<const std::byte*>(words);
+		size_t i = 0;
+#if defined(FIEA_SIMD_AVX2)
+		const __m256i wide = _mm256_set1_epi64x(static_cast<long long>(value));
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m256i equal = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + (i * sizeof(value)))), wide);
+			const int mask = _mm256_movemask_pd(_mm256_castsi256_pd(equal));
+			if (mask != 0)
+			{
+				return i + LowestSetBit(mask);
+			}
+		}
+#endif
+#if defined(FIEA_SIMD_AVX2) || defined(FIEA_SIMD_SSE2)
+		//SSE2 can only compare 32 bit lanes, so a word matches where both of its halves do.
+		const __m128i narrow = _mm_set1_epi64x(static_cast<long long>(value));
+		for (; i + 2 <= count; i += 2)
+		{
+			const __m128i halves = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + (i * sizeof(value)))), narrow);
+			const __m128i equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+			const int mask = _mm_movemask_pd(_mm_castsi128_pd(equal));
+			if (mask != 0)
+			{
+				return i + LowestSetBit(mask);
+			}
+		}
+#endif
+		for (; i < count; i++)
+		{
+			std::uint64_t word;
+			memcpy(&word, bytes + (i * sizeof(word)), sizeof(word));
+			if (word == value)
+			{
+				return i;
+			}
+		}
+		return count;
+	}
+
+	size_t Datum::LowestSetBit(int mask)
+	{
+		assert(mask != 0);
+		size_t bit = 0;
+		while ((mask & (1 << bit)) == 0)
+		{
+			bit++;
+		}
+		return bit;
 	}
 
 	bool Datum::Remove(size_t value)
@@ -1594,6 +2340,14 @@ namespace FieaGameEngine
 		}
 		return (RemoveAt(Find(value)));
 	}
+	bool Datum::Remove(ScopeHandle value)
+	{
+		if (DataType != DatumTypes::Handle)
+		{
+			throw std::runtime_error("Cannot remove value of type that differs from that of the Datum!");
+		}
+		return (RemoveAt(Find(value)));
+	}
 
 	bool Datum::RemoveAt(size_t index)
 	{
@@ -1601,16 +2355,22 @@ namespace FieaGameEngine
 		{
 			return false;
 		}
-		if (DataType == Datum::DatumTypes::String)
-		{
-			(Data.s + index)->~basic_string();
-		}
-		memmove(static_cast<std::byte*>(Data.vp) + (index * TypeSize[static_cast<size_t>(DataType)]), static_cast<std::byte*>(Data.vp) + ((index + 1) * TypeSize[static_cast<size_t>(DataType)]), (CurrentSize - index) * TypeSize[static_cast<size_t>(DataType)]);
+		NotifyChanged(index);
+		Unpack();
+		DestroyElements(index, index + 1);
+		memmove(static_cast<std::byte*>(Data.vp) + (index * TypeSize[static_cast<size_t>(DataType)]), static_cast<std::byte*>(Data.vp) + ((index + 1) * TypeSize[static_cast<size_t>(DataType)]), (CurrentSize - index - 1) * TypeSize[static_cast<size_t>(DataType)]);
 		CurrentSize--;
 		return true;
 	}
 
 	std::string Datum::ToString(size_t index) const
+	{
+		std::string result;
+		ToChars(result, index);
+		return result;
+	}
+
+	void Datum::ToChars(std::string& buffer, size_t index) const
 	{
 		if (DataType == DatumTypes::Unknown)
 		{
@@ -1619,23 +2379,144 @@ namespace FieaGameEngine
 
 		if (index < CurrentSize)
 		{
-			switch (DataType)
+			Dispatch(DataType, [this, &buffer, index](auto tag)
+			{
+				using T = typename decltype(tag)::Type;
+				if constexpr (std::is_same_v<T, std::string>)
+				{
+					buffer += GetStringView(index);
+				}
+				else if constexpr (std::is_same_v<T, RTTI*>)
+				{
+					buffer += Data.p[index]->ToString();
+				}
+				else if constexpr (IsValueElement<T>)
+				{
+					char characters[MaxElementChars];
+					buffer.append(characters, FormatElement(static_cast<const T*>(Data.vp)[index], characters));
+				}
+			});
+		}
+	}
+
+	void Datum::WriteAll(std::string& buffer) const
+	{
+		if (DataType == DatumTypes::Unknown)
+		{
+			throw std::runtime_error("Cannot convert typeless element to string!");
+		}
+		if (DataType == DatumTypes::String || DataType == DatumTypes::Pointer || DataType == DatumTypes::Table)
+		{
+			throw std::runtime_error("Only numeric and Handle datums may be written in bulk!");
+		}
+
+		Dispatch(DataType, [this, &buffer](auto tag)
+		{
+			using T = typename decltype(tag)::Type;
+			if constexpr (IsValueElement<T>)
+			{
+				const T* elements = static_cast<const T*>(Data.vp);
+				char characters[MaxElementChars];
+				for (size_t i = 0; i < CurrentSize; i++)
+				{
+					if (i > 0)
+					{
+						buffer += ", ";
+					}
+					buffer.append(characters, FormatElement(elements[i], characters));
+				}
+			}
+		});
+	}
+
+	template <typename T>
+	char* Datum::FormatElement(const T& element, char* first)
+	{
+		char* last = first + MaxElementChars;
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			const std::string_view text = element ? "true" : "false";
+			memcpy(first, text.data(), text.size());
+			return first + text.size();
+		}
+		else if constexpr (std::is_integral_v<T>)
+		{
+			return std::to_chars(first, last, element).ptr;
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			return FormatFloats(&element, 1, first);
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			const std::to_chars_result result = std::to_chars(first, last, element);
+			assert(result.ec == std::errc());
+			return result.ptr;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec2> || std::is_same_v<T, glm::vec3> || std::is_same_v<T, glm::vec4>)
+		{
+			memcpy(first, VectorPrefix<T>.data(), VectorPrefix<T>.size());
+			first = FormatFloats(reinterpret_cast<const float*>(&element), sizeof(T) / sizeof(float), first + VectorPrefix<T>.size());
+			*first++ = ')';
+			return first;
+		}
+		else if constexpr (std::is_same_v<T, glm::mat4> || std::is_same_v<T, glm::mat4x3>)
+		{
+			//Written column by column, as glm::to_string does, with three rows for a Transform.
+			constexpr size_t rows = sizeof(T) / (4 * sizeof(float));
+			const float* columns = reinterpret_cast<const float*>(&element);
+			memcpy(first, rows == 4 ? "mat4x4(" : "mat4x3(", 7);
+			first += 7;
+			for (size_t column = 0; column < 4; column++)
 			{
-			case FieaGameEngine::Datum::DatumTypes::Integer:
-				return std::to_string(GetConstInt(index));
-			case FieaGameEngine::Datum::DatumTypes::Float:
-				return std::to_string(GetConstFloat(index));
-			case FieaGameEngine::Datum::DatumTypes::String:
-				return GetConstString(index);
-			case FieaGameEngine::Datum::DatumTypes::Vector:
-				return glm::to_string(GetConstVector(index));
-			case FieaGameEngine::Datum::DatumTypes::Matrix:
-				return glm::to_string(GetConstMatrix(index));
-			case FieaGameEngine::Datum::DatumTypes::Pointer:
-				return GetConstRTTI(index)->ToString();
+				if (column > 0)
+				{
+					*first++ = ',';
+					*first++ = ' ';
+				}
+				*first++ = '(';
+				first = FormatFloats(columns + (column * rows), rows, first);
+				*first++ = ')';
 			}
+			*first++ = ')';
+			return first;
+		}
+		else if constexpr (std::is_same_v<T, glm::quat>)
+		{
+			//Written in the order taken by the glm::quat constructor, with the real part first, whatever order the components are stored in.
+			const float components[4] = { element.w, element.x, element.y, element.z };
+			memcpy(first, "quat(", 5);
+			first = FormatFloats(components, 4, first + 5);
+			*first++ = ')';
+			return first;
+		}
+		else
+		{
+			static_assert(std::is_same_v<T, ScopeHandle>, "Only numeric and Handle elements may be formatted.");
+			memcpy(first, "handle(", 7);
+			first = std::to_chars(first + 7, last, element.Index).ptr;
+			*first++ = ',';
+			*first++ = ' ';
+			first = std::to_chars(first, last, element.Generation).ptr;
+			*first++ = ')';
+			return first;
 		}
-		return "";
+	}
+
+	char* Datum::FormatFloats(const float* values, size_t count, char* first)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			if (i > 0)
+			{
+				*first++ = ',';
+				*first++ = ' ';
+			}
+			const std::to_chars_result result = std::to_chars(first, first + MaxFloatChars, values[i]);
+			assert(result.ec == std::errc());
+			first = result.ptr;
+		}
+		return first;
 	}
 
 	bool Datum::SetFromString(const char* value, size_t index)
@@ -1644,46 +2525,241 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot convert typeless element to string!");
 		}
-		if (index < CurrentSize && value != nullptr)
+		if (index >= CurrentSize || value == nullptr)
+		{
+			return false;
+		}
+
+		return Dispatch(DataType, [this, value, index](auto tag)
 		{
-			std::string stringValue = value;
-			switch (DataType)
+			using T = typename decltype(tag)::Type;
+			if constexpr (std::is_same_v<T, std::string>)
+			{
+				NotifyChanged(index);
+				Unpack();
+				Data.s[index] = value;
+				return true;
+			}
+			else if constexpr (IsValueElement<T>)
 			{
-			case FieaGameEngine::Datum::DatumTypes::Integer:
-				if (sscanf_s(value, "%u", reinterpret_cast<int32_t*>(& Data.i[index])) == static_cast<size_t>(1))
+				//Parsed into a copy first, so that a malformed value leaves the element as it was.
+				T element{};
+				if (ParseElement(value, value + strlen(value), element) != nullptr)
 				{
+					NotifyChanged(index);
+					static_cast<T*>(Data.vp)[index] = element;
 					return true;
 				}
-				break;
+				return false;
+			}
+			else
+			{
+				return false;
+			}
+		});
+	}
+
+	size_t Datum::SetAllFromString(std::string_view values)
+	{
+		if (DataType == DatumTypes::Unknown)
+		{
+			throw std::runtime_error("Cannot convert typeless element to string!");
+		}
+		if (DataType == DatumTypes::String || DataType == DatumTypes::Pointer || DataType == DatumTypes::Table)
+		{
+			throw std::runtime_error("Only numeric and Handle datums may be parsed in bulk!");
+		}
+		NotifyChanged();
+
+		if (!IsExternal)
+		{
+			CurrentSize = 0; //Numeric and Handle elements need no destruction.
+		}
 
-			case FieaGameEngine::Datum::DatumTypes::Float:
-				if (sscanf_s(value, "%f", &Data.f[index]) == 1)
+		return Dispatch(DataType, [this, values](auto tag)
+		{
+			using T = typename decltype(tag)::Type;
+			size_t parsed = 0;
+			if constexpr (IsValueElement<T>)
+			{
+				const char* position = values.data();
+				const char* last = values.data() + values.size();
+				for (;;)
 				{
-					return true;
+					position = SkipSpaces(position, last);
+					if (position == last)
+					{
+						break;
+					}
+					if (parsed > 0 && *position == ',')
+					{
+						position++;
+					}
+
+					if (IsExternal && parsed == CurrentSize)
+					{
+						break;
+					}
+					if (!IsExternal && CurrentSize == CurrentCapacity)
+					{
+						Reserve(GrownCapacity());
+					}
+
+					position = ParseElement(position, last, static_cast<T*>(Data.vp)[parsed]);
+					if (position == nullptr)
+					{
+						break;
+					}
+					parsed++;
+					if (!IsExternal)
+					{
+						CurrentSize = parsed;
+					}
 				}
-				break;
-			case FieaGameEngine::Datum::DatumTypes::String:
-					SetString(stringValue, index);
-					return true;
-				break;
-			case FieaGameEngine::Datum::DatumTypes::Vector:
-				if (sscanf_s(value, "vec4(%f, %f, %f, %f)", &Data.v[index].x, &Data.v[index].y, &Data.v[index].z, &Data.v[index].w) == 4)
+			}
+			return parsed;
+		});
+	}
+
+	template <typename T>
+	const char* Datum::ParseElement(const char* first, const char* last, T& element)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			const char* afterTrue = ParseLiteral(first, last, " true");
+			const bool value = afterTrue != nullptr;
+			first = value ? afterTrue : ParseLiteral(first, last, " false");
+			if (first != nullptr)
+			{
+				element = value;
+			}
+			return first;
+		}
+		else if constexpr (std::is_integral_v<T> || std::is_same_v<T, double>)
+		{
+			first = SkipSpaces(first, last);
+			if constexpr (std::is_same_v<T, double>)
+			{
+				if (first != last && *first == '+')
 				{
-					return true;
+					first++; //Accepted by scanf, but not by from_chars.
 				}
-				break;
-			case FieaGameEngine::Datum::DatumTypes::Matrix:
-				if (sscanf_s(value, "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))", &Data.m[index][0][0], &Data.m[index][0][1], &Data.m[index][0][2], &Data.m[index][0][3],
-					&Data.m[index][1][0], &Data.m[index][1][1], &Data.m[index][1][2], &Data.m[index][1][3],
-					&Data.m[index][2][0], &Data.m[index][2][1], &Data.m[index][2][2], &Data.m[index][2][3],
-					&Data.m[index][3][0], &Data.m[index][3][1], &Data.m[index][3][2], &Data.m[index][3][3]) == 16)
+			}
+			const std::from_chars_result result = std::from_chars(first, last, element);
+			return result.ec == std::errc() ? result.ptr : nullptr;
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			return ParseFloats(first, last, &element, 1);
+		}
+		else if constexpr (std::is_same_v<T, glm::vec2> || std::is_same_v<T, glm::vec3> || std::is_same_v<T, glm::vec4>)
+		{
+			first = SkipSpaces(first, last);
+			first = ParseLiteral(first, last, VectorPrefix<T>);
+			first = ParseFloats(first, last, reinterpret_cast<float*>(&element), sizeof(T) / sizeof(float));
+			return ParseLiteral(first, last, " )");
+		}
+		else if constexpr (std::is_same_v<T, glm::mat4> || std::is_same_v<T, glm::mat4x3>)
+		{
+			constexpr size_t rows = sizeof(T) / (4 * sizeof(float));
+			first = ParseLiteral(first, last, rows == 4 ? " mat4x4(" : " mat4x3(");
+			float* columns = reinterpret_cast<float*>(&element);
+			for (size_t column = 0; column < 4; column++)
+			{
+				first = ParseLiteral(first, last, column == 0 ? " (" : " , (");
+				first = ParseFloats(first, last, columns + (column * rows), rows);
+				first = ParseLiteral(first, last, " )");
+			}
+			return ParseLiteral(first, last, " )");
+		}
+		else if constexpr (std::is_same_v<T, glm::quat>)
+		{
+			float components[4];
+			first = ParseLiteral(first, last, " quat(");
+			first = ParseLiteral(ParseFloats(first, last, components, 4), last, " )");
+			if (first != nullptr)
+			{
+				element = glm::quat(components[0], components[1], components[2], components[3]);
+			}
+			return first;
+		}
+		else
+		{
+			static_assert(std::is_same_v<T, ScopeHandle>, "Only numeric and Handle elements may be parsed.");
+			first = ParseLiteral(first, last, " handle( ");
+			if (first == nullptr)
+			{
+				return nullptr;
+			}
+			std::from_chars_result result = std::from_chars(first, last, element.Index);
+			if (result.ec != std::errc())
+			{
+				return nullptr;
+			}
+			first = ParseLiteral(result.ptr, last, " , ");
+			if (first == nullptr)
+			{
+				return nullptr;
+			}
+			result = std::from_chars(first, last, element.Generation);
+			if (result.ec != std::errc())
+			{
+				return nullptr;
+			}
+			return ParseLiteral(result.ptr, last, " )");
+		}
+	}
+
+	const char* Datum::ParseLiteral(const char* first, const char* last, std::string_view literal)
+	{
+		if (first == nullptr)
+		{
+			return nullptr;
+		}
+		for (char expected : literal)
+		{
+			if (expected == ' ')
+			{
+				first = SkipSpaces(first, last);
+			}
+			else if (first == last || *first++ != expected)
+			{
+				return nullptr;
+			}
+		}
+		return first;
+	}
+
+	const char* Datum::ParseFloats(const char* first, const char* last, float* values, size_t count)
+	{
+		for (size_t i = 0; i < count && first != nullptr; i++)
+		{
+			if (i > 0)
+			{
+				first = ParseLiteral(first, last, " ,");
+				if (first == nullptr)
 				{
-					return true;
+					return nullptr;
 				}
-				break;
 			}
+			first = SkipSpaces(first, last);
+			if (first != last && *first == '+')
+			{
+				first++; //Accepted by scanf, but not by from_chars.
+			}
+			const std::from_chars_result result = std::from_chars(first, last, values[i]);
+			first = result.ec == std::errc() ? result.ptr : nullptr;
+		}
+		return first;
+	}
+
+	const char* Datum::SkipSpaces(const char* first, const char* last)
+	{
+		while (first != last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\r'))
+		{
+			first++;
 		}
-		return false;
+		return first;
 	}
 
 	void Datum::DeepCopy(const Datum& copiedDatum)
@@ -1701,24 +2777,100 @@ namespace FieaGameEngine
 		}
 		else //Needs deep copy
 		{
-			switch (DataType)
+			CopyElements(copiedDatum);
+		}
+	}
+
+	void Datum::CopyElements(const Datum& copiedDatum)
+	{
+		SetType(copiedDatum.DataType);
+		if (DataType == DatumTypes::Table || DataType == DatumTypes::Unknown || copiedDatum.CurrentSize == 0)
+		{
+			return;
+		}
+
+		Reserve(copiedDatum.CurrentSize);
+		if (copiedDatum.Packed)
+		{
+			//The copy is unpacked, so that it may be read with GetConstString like any other String Datum.
+			for (size_t i = 0; i < copiedDatum.CurrentSize; i++)
 			{
-			case(DatumTypes::String):
-				for (size_t i = 0; i < copiedDatum.CurrentSize; i++)
-				{
-					PushBack(copiedDatum.Data.s[i]);
-				}
-				break;
+				new(Data.s + i) std::string(copiedDatum.GetStringView(i));
+			}
+			CurrentSize = copiedDatum.CurrentSize;
+			return;
+		}
+		Dispatch(DataType, [this, &copiedDatum](auto tag)
+		{
+			using T = typename decltype(tag)::Type;
+			const T* source = static_cast<const T*>(copiedDatum.Data.vp);
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				memcpy(Data.vp, source, copiedDatum.CurrentSize * sizeof(T));
+			}
+			else
+			{
+				std::uninitialized_copy_n(source, copiedDatum.CurrentSize, static_cast<T*>(Data.vp));
+			}
+		});
+		CurrentSize = copiedDatum.CurrentSize;
+	}
+
+	void Datum::AssignElements(const Datum& copiedDatum)
+	{
+		if (this == &copiedDatum)
+		{
+			return;
+		}
+		SetType(copiedDatum.DataType);
+		if (DataType == DatumTypes::Table || DataType == DatumTypes::Unknown)
+		{
+			return;
+		}
+		NotifyChanged();
 
-			case(DatumTypes::Table):
-				break;
+		if (copiedDatum.Packed && Packed)
+		{
+			//A Datum that was already packed takes the whole block at once, so that it stays packed.
+			Clear();
+			const size_t bytes = copiedDatum.PackedBytes();
+			Data.vp = AlignedMemory::Allocate(bytes, AlignedMemory::AlignmentOf<PackedString>());
+			assert(Data.vp != nullptr);
+			memcpy(Data.vp, copiedDatum.Data.vp, bytes);
+			CurrentSize = copiedDatum.CurrentSize;
+			CurrentCapacity = CurrentSize;
+			Packed = true;
+			return;
+		}
 
-			default:
-				Reserve(copiedDatum.Size());
-				memcpy(Data.vp, copiedDatum.Data.vp, TypeSize[static_cast<size_t>(DataType)] * copiedDatum.CurrentSize);
-				CurrentSize = copiedDatum.CurrentSize;
+		const size_t count = IsExternal ? std::min(CurrentSize, copiedDatum.CurrentSize) : copiedDatum.CurrentSize;
+		Unpack();
+		Reserve(count);
+		if (DataType == DatumTypes::String)
+		{
+			const size_t assigned = std::min(count, CurrentSize);
+			for (size_t i = 0; i < assigned; i++)
+			{
+				Data.s[i] = copiedDatum.GetStringView(i);
+			}
+			for (size_t i = assigned; i < count; i++)
+			{
+				new(Data.s + i) std::string(copiedDatum.GetStringView(i));
+			}
+			for (size_t i = count; i < CurrentSize && !IsExternal; i++)
+			{
+				Data.s[i].~basic_string();
 			}
 		}
+		else if (count > 0)
+		{
+			memcpy(Data.vp, copiedDatum.Data.vp, TypeSize[static_cast<size_t>(DataType)] * count);
+		}
+
+		if (!IsExternal)
+		{
+			CurrentSize = count;
+		}
 	}
 
 	bool Datum::IsExternalStorage()
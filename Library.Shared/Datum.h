@@ -1,14 +1,22 @@
 #pragma once
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #pragma warning(push)
 #pragma warning(disable:4201)
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/string_cast.hpp>
 #pragma warning(pop)
 #include "RTTI.h"
+#include "ScopeHandle.h"
+#include "AlignedMemory.h"
+#include <gsl/gsl>
 #include <stdexcept>
+#include <tuple>
+#include <string_view>
+#include <type_traits>
 #include <memory>
 #include <assert.h>
 
@@ -17,6 +25,10 @@ namespace FieaGameEngine
 	class Attributed;
 	class Scope;
 	class JsonTableParseHelper;
+	class FrozenScopeTable;
+	class ScopeRelayout;
+	class DatumObserver;
+	class DatumMath;
 	/// <summary>
 	/// The Datum class is used to contain pointers to elements from a list of supported types. These elements are stored contiguously and can be removed, added, set, stored via internal or
 	/// external data storage, and converted to strings.
@@ -27,6 +39,10 @@ namespace FieaGameEngine
 		friend Scope;
 		friend Attributed;
 		friend JsonTableParseHelper;
+		friend FrozenScopeTable;
+		friend ScopeRelayout;
+		friend DatumObserver;
+		friend DatumMath;
 		/// <summary>
 		/// Specifies the data type stored within the Datum object, Unknown by default. Ensures operations always use proper datum type.
 		/// </summary>
@@ -39,7 +55,16 @@ namespace FieaGameEngine
 			Vector,
 			Matrix,
 			Pointer,
-			Table
+			Table,
+			Handle,
+			Int32,
+			Int64,
+			Double,
+			Boolean,
+			Vector2,
+			Vector3,
+			Quaternion,
+			Transform
 		};
 		//Basic constructors
 		/// <summary>
@@ -73,7 +98,12 @@ namespace FieaGameEngine
 		/// Datum constructor that takes a string value argument. Initializes the Datum with the String type and a pointer to the value specified.
 		/// </summary>
 		/// <param name="value">The string value to be stored first on the Datum.</param>
-		Datum(std::string& value);
+		Datum(const std::string& value);
+		/// <summary>
+		/// Datum constructor that takes a string value argument, moving it in rather than copying it. Initializes the Datum with the String type and the value specified.
+		/// </summary>
+		/// <param name="value">The string value to be moved into the Datum as its first element.</param>
+		Datum(std::string&& value);
 		/// <summary>
 		/// Datum constructor that takes a vector4 value argument from the glm library. Initializes the Datum with the Vector type and a pointer to the value specified.
 		/// </summary>
@@ -83,13 +113,18 @@ namespace FieaGameEngine
 		/// Datum constructor that takes a matrix value argument. Initializes the Datum with the Matrix type and a pointer to the value specified.
 		/// </summary>
 		/// <param name="value">The matrix value to be stored first on the Datum.</param>
-		Datum(glm::mat4& value);
+		Datum(const glm::mat4& value);
 		/// <summary>
 		/// Datum constructor that takes an RTTI* value argument. Initializes the Datum with the Pointer type and a pointer to the value specified.
 		/// </summary>
 		/// <param name="value">The RTTI* value to be stored first on the Datum.</param>
 		Datum(RTTI* value);
 		Datum(Scope* value);
+		/// <summary>
+		/// Datum constructor that takes a ScopeHandle value argument. Initializes the Datum with the Handle type and the handle specified.
+		/// </summary>
+		/// <param name="value">The ScopeHandle value to be stored first on the Datum.</param>
+		Datum(ScopeHandle value);
 
 		/// <summary>
 		/// Datum constructor that takes in a starting size_t value and size to reserve for the Datum. Assigns type to Integer, pushes value onto the Datum, and calls reserve to delegate memory.
@@ -110,6 +145,13 @@ namespace FieaGameEngine
 		/// <param name="size">The number of element-sized spaces to reserve for the new Datum.</param>
 		Datum(const std::string& value, size_t size);
 		/// <summary>
+		/// Datum constructor that takes in a starting string value and size to reserve for the Datum, moving the value in rather than copying it. Assigns type to String, reserves memory, and pushes the
+		/// value onto the Datum.
+		/// </summary>
+		/// <param name="value">The initial string value to be moved into the datum.</param>
+		/// <param name="size">The number of element-sized spaces to reserve for the new Datum.</param>
+		Datum(std::string&& value, size_t size);
+		/// <summary>
 		/// Datum constructor that takes in a starting vector4 value from the glm library and size to reserve for the Datum. Assigns type to Vector, pushes value onto the Datum, and calls reserve to delegate memory.
 		/// </summary>
 		/// <param name="value">The initial Vector4 value that should be pointed to on the datum.</param>
@@ -127,6 +169,12 @@ namespace FieaGameEngine
 		/// <param name="value">The initial RTTI* value that should be pointed to on the datum.</param>
 		/// <param name="size">The number of element-sized spaces to reserve for the new Datum.</param>
 		Datum(RTTI* value, size_t size);
+		/// <summary>
+		/// Datum constructor that takes in a starting ScopeHandle value and size to reserve for the Datum. Assigns type to Handle, pushes value onto the Datum, and calls reserve to delegate memory.
+		/// </summary>
+		/// <param name="value">The initial ScopeHandle value that should be stored on the datum.</param>
+		/// <param name="size">The number of element-sized spaces to reserve for the new Datum.</param>
+		Datum(ScopeHandle value, size_t size);
 
 		//Datum copy logic
 		/// <summary>
@@ -142,6 +190,13 @@ namespace FieaGameEngine
 		/// <param name="copiedDatum">The Datum to be copied into the calling Datum.</param>
 		/// <returns>A reference to the new copied Datum.</returns>
 		Datum& operator=(const Datum& copiedDatum);
+		/// <summary>
+		/// Copies the elements of the provided Datum into the calling Datum, reusing its existing storage rather than replacing it. Internal storage only grows when it is too small, and existing strings
+		/// are assigned in place. External storage is never resized, so only as many elements as it already holds are copied. Table elements are not copied, as nested Scopes belong to a single parent.
+		/// Throws a runtime error if the calling Datum already holds a different type.
+		/// </summary>
+		/// <param name="copiedDatum">The Datum whose elements are copied.</param>
+		void AssignElements(const Datum& copiedDatum);
 
 		//DatumType scalar assignment operators
 		/// <summary>
@@ -166,6 +221,13 @@ namespace FieaGameEngine
 		/// <returns>A reference to the new asigned Datum.</returns>
 		Datum& operator=(const std::string& newValue);
 		/// <summary>
+		/// Datum move assignment operator for String values. Treats the Datum as a scalar and moves the provided string in as its first and only value. Only works for Datum of unknown or String types,
+		/// and those that are managed internally. If Datum has existing values, they are cleared prior to assignment.
+		/// </summary>
+		/// <param name="newValue">The string value to be moved into the Datum.</param>
+		/// <returns>A reference to the new asigned Datum.</returns>
+		Datum& operator=(std::string&& newValue);
+		/// <summary>
 		/// Datum copy assignment operator for Vector4 values. Treats the Datum as a scalar and assigns its first and only value as a reference to the provided argument's value. Only works for
 		/// Datum of unknown or Vector types, and those that are managed internally. If Datum has existing values, they are cleared prior to assignment.
 		/// </summary>
@@ -186,6 +248,13 @@ namespace FieaGameEngine
 		/// <param name="newValue">The RTTI* value to be assigned to the Datum.</param>
 		/// <returns>A reference to the new asigned Datum.</returns>
 		Datum& operator=(RTTI* newValue);
+		/// <summary>
+		/// Datum copy assignment operator for ScopeHandle values. Treats the Datum as a scalar and assigns its first and only value as the provided handle. Only works for Datum of unknown or Handle
+		/// types, and those that are managed internally. If Datum has existing values, they are cleared prior to assignment.
+		/// </summary>
+		/// <param name="newValue">The ScopeHandle value to be assigned to the Datum.</param>
+		/// <returns>A reference to the new asigned Datum.</returns>
+		Datum& operator=(ScopeHandle newValue);
 		//private:
 	//	Datum& operator=(Scope*& newValue);
 
@@ -203,10 +272,12 @@ namespace FieaGameEngine
 		Datum(Datum&& copiedDatum) noexcept;
 		/// <summary>
 		/// Move assignment operator for Datum that makes a shallow copy from the provided Datum argument into the calling Datum. Upon completion, the calling datum is identical to the argument passed,
-		/// and the argument is no longer usable. If the calling datum has existing elements already, they are cleared prior to assignment.
+		/// and the argument is no longer usable. If the calling datum has existing elements already, they are cleared prior to assignment. If the calling datum stores its elements externally and the
+		/// argument does not, the argument's elements are instead copied into that storage, as many as it holds, and the argument keeps its own. Throws a runtime error if an external calling datum
+		/// holds a different type. Not noexcept, as notifying the owning scope may journal the change, which can allocate.
 		/// </summary>
 		///	<param name="copiedDatum">The provided data argument that is copied into the calling datum.</param>
-		Datum& operator=(Datum&& copiedDatum) noexcept;
+		Datum& operator=(Datum&& copiedDatum);
 
 		//Comparison operators
 		/// <summary>
@@ -305,6 +376,20 @@ namespace FieaGameEngine
 		/// <param name="comparedDatum">The RTTI pointer being compared to the calling Datum.</param>
 		/// <returns>A boolean indicating whether or not the two scalars are considered functionally unequal.</returns>
 		bool operator!=(const RTTI* comparedDatum) const;
+		/// <summary>
+		/// Equality operator that compares the calling Datum and argument-provided ScopeHandle, treating the datum as a scalar and comparing the first element. Handles are equal when they name the same
+		/// slot and generation. Does not proceed if the Datum is not of the handle type or if the Datum is empty.
+		/// </summary>
+		/// <param name="comparedDatum">The ScopeHandle being compared to the calling Datum.</param>
+		/// <returns>A boolean indicating whether or not the two scalars are considered functionally equal.</returns>
+		bool operator==(const ScopeHandle& comparedDatum) const;
+		/// <summary>
+		/// Inequality operator that compares the calling Datum and argument-provided ScopeHandle, treating the datum as a scalar and comparing the first element. Does not proceed if the
+		/// Datum is not of the handle type or if the Datum is empty.
+		/// </summary>
+		/// <param name="comparedDatum">The ScopeHandle being compared to the calling Datum.</param>
+		/// <returns>A boolean indicating whether or not the two scalars are considered functionally unequal.</returns>
+		bool operator!=(const ScopeHandle& comparedDatum) const;
 
 		//Destructor
 		/// <summary>
@@ -337,7 +422,7 @@ namespace FieaGameEngine
 		size_t Capacity() const;
 
 		/// <summary>
-		/// Allows the datum to grow or shrink to the size specified. Upon completion, capacity and size are equal. Datum requires a type that is not Unknown to function.
+		/// Allows the datum to grow or shrink to the size specified. Upon completion, capacity and size are equal, unless the elements fit in the inline storage of the Datum. Datum requires a type that is not Unknown to function.
 		/// </summary>
 		/// <param name="size">The new size and capacity for the Datum.</param>
 		void Resize(size_t size);
@@ -348,16 +433,247 @@ namespace FieaGameEngine
 		/// <param name="size">The new capacity for the Datum.</param>
 		void Reserve(size_t size);
 
+		/// <summary>
+		/// A function computing the capacity a full Datum grows to when an element is pushed onto it, provided its current capacity. Results not greater than the current capacity are raised to one
+		/// greater than it.
+		/// </summary>
+		using GrowthPolicy = size_t(*)(size_t capacity);
+		/// <summary>
+		/// The default growth policy, which doubles capacity, starting from a capacity of four, so that pushing n elements reallocates only about log2(n) times.
+		/// </summary>
+		/// <param name="capacity">The current capacity of the full Datum.</param>
+		/// <returns>The capacity the Datum grows to.</returns>
+		[[nodiscard]] static size_t DoubleCapacity(size_t capacity);
+		/// <summary>
+		/// Sets the growth policy used by every Datum, or restores the default if nullptr is provided. Growing by one element at a time, as with a policy returning its argument plus one, keeps
+		/// capacity equal to size at the cost of reallocating on every push.
+		/// </summary>
+		/// <param name="policy">The growth policy to use.</param>
+		static void SetGrowthPolicy(GrowthPolicy policy);
+		/// <summary>
+		/// Returns the growth policy used by every Datum.
+		/// </summary>
+		/// <returns>The current growth policy.</returns>
+		[[nodiscard]] static GrowthPolicy GetGrowthPolicy();
+
+		//Bulk append functions
+		/// <summary>
+		/// Appends every provided value onto the back of the Datum, reserving space for all of them at once. Does not work if Datum type is anything besides Unknown or Integer, or if the Datum is
+		/// external and lacks room for the values.
+		/// </summary>
+		/// <param name="values">The values to be appended.</param>
+		void Append(gsl::span<const size_t> values);
+		/// <summary>
+		/// Appends every provided value onto the back of the Datum, reserving space for all of them at once. Does not work if Datum type is anything besides Unknown or Float, or if the Datum is
+		/// external and lacks room for the values.
+		/// </summary>
+		/// <param name="values">The values to be appended.</param>
+		void Append(gsl::span<const float> values);
+		/// <summary>
+		/// Appends every provided value onto the back of the Datum, reserving space for all of them at once. Does not work if Datum type is anything besides Unknown or String, or if the Datum is
+		/// external and lacks room for the values.
+		/// </summary>
+		/// <param name="values">The values to be appended.</param>
+		void Append(gsl::span<const std::string> values);
+		/// <summary>
+		/// Appends every provided value onto the back of the Datum, reserving space for all of them at once. Does not work if Datum type is anything besides Unknown or Vector, or if the Datum is
+		/// external and lacks room for the values.
+		/// </summary>
+		/// <param name="values">The values to be appended.</param>
+		void Append(gsl::span<const glm::vec4> values);
+		/// <summary>
+		/// Appends every provided value onto the back of the Datum, reserving space for all of them at once. Does not work if Datum type is anything besides Unknown or Matrix, or if the Datum is
+		/// external and lacks room for the values.
+		/// </summary>
+		/// <param name="values">The values to be appended.</param>
+		void Append(gsl::span<const glm::mat4> values);
+		/// <summary>
+		/// Appends every provided value onto the back of the Datum, reserving space for all of them at once. Does not work if Datum type is anything besides Unknown or Pointer, or if the Datum is
+		/// external and lacks room for the values.
+		/// </summary>
+		/// <param name="values">The values to be appended.</param>
+		void Append(gsl::span<RTTI* const> values);
+		/// <summary>
+		/// Appends every provided value onto the back of the Datum, reserving space for all of them at once. Does not work if Datum type is anything besides Unknown or Handle, or if the Datum is
+		/// external and lacks room for the values.
+		/// </summary>
+		/// <param name="values">The values to be appended.</param>
+		void Append(gsl::span<const ScopeHandle> values);
+
+		//Typed access functions
+		/// <summary>
+		/// Whether or not T is the element type of one of the compact Datum types: std::int32_t, std::int64_t, double, bool, glm::vec2, glm::vec3, glm::quat or glm::mat4x3. Compact types have no named accessors,
+		/// and are instead used through the typed access functions, such as Get<bool>, and through SetStorage, Signatures and string conversion. A Transform holds an affine transform as a glm::mat4x3,
+		/// the three basis columns and the translation of a glm::mat4 whose bottom row is always (0, 0, 0, 1), in 48 bytes rather than 64.
+		/// </summary>
+		template <typename T>
+		static constexpr bool IsCompactType = std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::int64_t> || std::is_same_v<T, double> || std::is_same_v<T, bool> ||
+			std::is_same_v<T, glm::vec2> || std::is_same_v<T, glm::vec3> || std::is_same_v<T, glm::quat> || std::is_same_v<T, glm::mat4x3>;
+		/// <summary>
+		/// Whether or not T is the element type of one of the Datum types: size_t, float, std::string, glm::vec4, glm::mat4, RTTI*, Scope* or ScopeHandle, or one of the compact types.
+		/// </summary>
+		template <typename T>
+		static constexpr bool IsElementType = std::is_same_v<T, size_t> || std::is_same_v<T, float> || std::is_same_v<T, std::string> || std::is_same_v<T, glm::vec4> ||
+			std::is_same_v<T, glm::mat4> || std::is_same_v<T, RTTI*> || std::is_same_v<T, Scope*> || std::is_same_v<T, ScopeHandle> || IsCompactType<T>;
+		/// <summary>
+		/// Returns the Datum type whose elements are of type T, resolved at compile time.
+		/// </summary>
+		/// <returns>The Datum type holding elements of type T.</returns>
+		template <typename T>
+		[[nodiscard]] static constexpr DatumTypes TypeOf();
+		/// <summary>
+		/// The element type of every Datum type, in the order of DatumTypes. Unknown holds no elements, and so is void.
+		/// </summary>
+		using ElementTypes = std::tuple<void, size_t, float, std::string, glm::vec4, glm::mat4, RTTI*, Scope*, ScopeHandle, std::int32_t, std::int64_t, double, bool, glm::vec2, glm::vec3, glm::quat,
+			glm::mat4x3>;
+		/// <summary>
+		/// The element type of the provided Datum type, resolved at compile time, the inverse of TypeOf.
+		/// </summary>
+		template <DatumTypes Type>
+		using ElementType = std::tuple_element_t<static_cast<size_t>(Type), ElementTypes>;
+
+		/// <summary>
+		/// Calls the provided visitor once with a span over every element of the Datum, typed by the Datum's type, so that a single generic lambda such as [](auto elements) { ... } can work on any
+		/// Datum. The type is switched on once per call, and the visitor is compiled separately for each element type, so loops within it pay nothing per element. The visitor must return the same
+		/// type for every element type. Writes through the span are reported as a change to the entire Datum, and Table elements are visited through a const span, as they may only be changed through
+		/// their parent scope. Throws a runtime error if the Datum's type is Unknown.
+		/// </summary>
+		/// <param name="visitor">The callable to be called with the span over the elements.</param>
+		/// <returns>The value returned by the visitor.</returns>
+		template <typename Visitor>
+		decltype(auto) Visit(Visitor&& visitor);
+		/// <summary>
+		/// Calls the provided visitor once with a const span over every element of the Datum, typed by the Datum's type. Throws a runtime error if the Datum's type is Unknown, or if it is a packed
+		/// String Datum, whose elements are read with GetStringView.
+		/// </summary>
+		/// <param name="visitor">The callable to be called with the span over the elements.</param>
+		/// <returns>The value returned by the visitor.</returns>
+		template <typename Visitor>
+		decltype(auto) Visit(Visitor&& visitor) const;
+
+		/// <summary>
+		/// Returns a span over every element of the Datum, after checking once that the Datum holds elements of type T. Indexing the span performs no further checks, so loops over it compile down to
+		/// plain array accesses. Writes through the span are reported to the owning scope as a change to the entire Datum when the span is taken, and from then on the Datum's elements are left out of
+		/// the owning scope's structural hash. The span is invalidated by anything that changes the capacity of the Datum. Table elements may not be changed directly, and so may only be viewed through
+		/// the const overload.
+		/// </summary>
+		/// <returns>A span over the elements of the Datum.</returns>
+		template <typename T>
+		[[nodiscard]] gsl::span<T> As();
+		/// <summary>
+		/// Returns a const span over every element of the Datum, after checking once that the Datum holds elements of type T. Throws a runtime error if it does not.
+		/// </summary>
+		/// <returns>A const span over the elements of the Datum.</returns>
+		template <typename T>
+		[[nodiscard]] gsl::span<const T> As() const;
+		/// <summary>
+		/// Returns a reference to the element at the provided index, equivalent to the Get function for type T, such as GetFloat for float, but chosen at compile time. T must be named explicitly. As
+		/// with As, the Datum's elements are left out of the owning scope's structural hash from then on.
+		/// </summary>
+		/// <param name="index">The index of the element to return.</param>
+		/// <returns>A reference to the element at the provided index.</returns>
+		template <typename T>
+		[[nodiscard]] T& Get(size_t index = 0);
+		/// <summary>
+		/// Returns a const reference to the element at the provided index. Throws a runtime error if the index is out of bounds or the Datum does not hold elements of type T.
+		/// </summary>
+		/// <param name="index">The index of the element to return.</param>
+		/// <returns>A const reference to the element at the provided index.</returns>
+		template <typename T>
+		[[nodiscard]] const T& Get(size_t index = 0) const;
+		/// <summary>
+		/// Sets the element at the provided index to the provided value, equivalent to the Set function for type T, such as SetFloat for float, but chosen at compile time. T must be named explicitly.
+		/// </summary>
+		/// <param name="value">The value the element is set to.</param>
+		/// <param name="index">The index of the element to set.</param>
+		template <typename T>
+		void Set(const std::enable_if_t<IsElementType<T>, T>& value, size_t index = 0);
+		/// <summary>
+		/// Sets the element at the provided index to the provided value, moving it in rather than copying it. T must be named explicitly.
+		/// </summary>
+		/// <param name="value">The value to be moved into the element.</param>
+		/// <param name="index">The index of the element to set.</param>
+		template <typename T>
+		void Set(std::enable_if_t<IsElementType<T>, T>&& value, size_t index = 0);
+		/// <summary>
+		/// Pushes the provided value onto the back of the Datum, equivalent to the PushBack overload for type T but chosen at compile time. T must be named explicitly, so that calls without a template
+		/// argument keep resolving to the existing overloads.
+		/// </summary>
+		/// <param name="value">The value to be pushed to the back of the Datum.</param>
+		template <typename T>
+		void PushBack(const std::enable_if_t<IsElementType<T>, T>& value);
+		/// <summary>
+		/// Pushes the provided value onto the back of the Datum, moving it in rather than copying it. T must be named explicitly.
+		/// </summary>
+		/// <param name="value">The value to be moved onto the back of the Datum.</param>
+		template <typename T>
+		void PushBack(std::enable_if_t<IsElementType<T>, T>&& value);
+		/// <summary>
+		/// Constructs a new element of type T in place at the back of the Datum from the provided arguments, growing capacity according to the growth policy if needed. T must be named explicitly, and
+		/// the Datum must be of the type holding elements of type T or Unknown. Table elements may only be added through their parent scope.
+		/// </summary>
+		/// <param name="arguments">The arguments passed to the constructor of the new element.</param>
+		/// <returns>A reference to the new element, invalidated by anything that changes the capacity of the Datum.</returns>
+		template <typename T, typename... Arguments>
+		T& EmplaceBack(Arguments&&... arguments);
+		/// <summary>
+		/// Searches for the provided value in the Datum, equivalent to the Find overload for type T but chosen at compile time. T must be named explicitly. Throws a runtime error if the Datum does not
+		/// hold elements of type T.
+		/// </summary>
+		/// <param name="value">The value to be searched for within the Datum.</param>
+		/// <returns>A size_t indicating what index the value was found at, set to the size of the Datum if not found.</returns>
+		template <typename T>
+		[[nodiscard]] size_t Find(const std::enable_if_t<IsElementType<T>, T>& value) const;
+		/// <summary>
+		/// Appends every provided value of a compact type onto the back of the Datum, reserving space for all of them at once. T must be named explicitly. Does not work if Datum type is anything besides
+		/// Unknown or the type holding elements of type T, or if the Datum is external and lacks room for the values.
+		/// </summary>
+		/// <param name="values">The values to be appended.</param>
+		template <typename T>
+		void Append(gsl::span<const std::enable_if_t<IsCompactType<T>, T>> values);
+		/// <summary>
+		/// Sets external storage for the calling datum to the provided array of elements of type T. Used for the compact types, which have no overload of their own, and so T must be named explicitly.
+		/// Does not work unless Data type is the type holding elements of type T or Unknown, and does not work if the Datum already has elements stored internally.
+		/// </summary>
+		/// <param name="elementArray">The storage array to be allocated for external storage.</param>
+		/// <param name="elements">The size for the external storage allocation.</param>
+		template <typename T>
+		void SetStorage(std::enable_if_t<IsCompactType<T>, T>* elementArray, size_t elements);
+
 		//Memory removal
 		/// <summary>
 		/// Removes all existing elements from the Datum without affecting capacity.
 		/// </summary>
 		void Clear();
 		/// <summary>
-		/// Changes the capacity and storage space allocated to the Datum to match the size of the datum, the number of elements currently stored.
+		/// Changes the capacity and storage space allocated to the Datum to match the size of the datum, the number of elements currently stored. A Datum whose elements fit in its inline storage
+		/// keeps the full inline capacity, as it costs nothing to hold.
 		/// </summary>
 		void ShrinkToFit();
 
+		//Packed string functions
+		/// <summary>
+		/// Packs an internal String Datum, moving the characters of every element into a single block holding the offset and length of each element followed by all of their characters. Copying a
+		/// packed Datum into another packed Datum with AssignElements then takes one allocation however many elements it holds; any other copy is unpacked, so that it can be read with GetConstString.
+		/// A packed Datum is read with GetStringView, as it holds no std::string for GetConstString to return; any change to its elements, including through GetString, unpacks it again first.
+		/// Does nothing if the Datum is already packed or empty.
+		/// </summary>
+		void Pack();
+		/// <summary>
+		/// Unpacks a packed String Datum, giving each element a std::string of its own again. Does nothing if the Datum is not packed.
+		/// </summary>
+		void Unpack();
+		/// <summary>
+		/// Returns a boolean indicating whether or not the Datum is a packed String Datum.
+		/// </summary>
+		/// <returns>A boolean indicating whether or not the Datum is packed.</returns>
+		[[nodiscard]] bool IsPacked() const;
+		/// <summary>
+		/// Replaces the elements of an internal String or Unknown Datum with the provided strings, packed into a single block with one allocation.
+		/// </summary>
+		/// <param name="values">The strings the Datum is set to hold.</param>
+		void SetPacked(gsl::span<const std::string_view> values);
+
 		//Set storage functions
 		/// <summary>
 		/// Sets external storage for the calling datum. Provided an array of integers and the number of elements for it to hold, the Datum will have external storage set to the array for the
@@ -401,6 +717,13 @@ namespace FieaGameEngine
 		/// <param name="elementArray">The storage array to be allocated for external storage.</param>
 		/// <param name="elements">The size for the external storage allocation.</param>
 		void SetStorage(RTTI** elementArray, size_t elements);
+		/// <summary>
+		/// Sets external storage for the calling datum. Provided an array of ScopeHandles and the number of elements for it to hold, the Datum will have external storage set to the array for the
+		/// number of indicated elements. Does not work unless Data type is specified to Handle or Unknown, and does not work if the Datum already has elements stored internally.
+		/// </summary>
+		/// <param name="elementArray">The storage array to be allocated for external storage.</param>
+		/// <param name="elements">The size for the external storage allocation.</param>
+		void SetStorage(ScopeHandle* elementArray, size_t elements);
 
 		//Set functions
 		/// <summary>
@@ -423,7 +746,14 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="value">The string value to be set at the specified index.</param>
 		/// <param name="index">The index referring to the value to be changed in the existing datum.</param>
-		void SetString(std::string& value, size_t index = 0);
+		void SetString(const std::string& value, size_t index = 0);
+		/// <summary>
+		/// Sets the specified index in the array to the provided String value, moving it in rather than copying it. Index is 0 by default. Does not work if the index provided is greater than the size
+		/// or if the Datum is not of the String DatumType.
+		/// </summary>
+		/// <param name="value">The string value to be moved into the specified index.</param>
+		/// <param name="index">The index referring to the value to be changed in the existing datum.</param>
+		void SetString(std::string&& value, size_t index = 0);
 		/// <summary>
 		/// Sets the specified index in the array with the provided Vector4 value. Index is 0 by default. Does not work if the index provided is greater than the size or if the Datum is not of the
 		/// Vector DatumType.
@@ -437,7 +767,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="value">The matrix 4x4 value to be set at the specified index.</param>
 		/// <param name="index">The index referring to the value to be changed in the existing datum.</param>
-		void SetMatrix(glm::mat4& value, size_t index = 0);
+		void SetMatrix(const glm::mat4& value, size_t index = 0);
 		/// <summary>
 		/// Sets the specified index in the array with the provided RTTI pointer value. Index is 0 by default. Does not work if the index provided is greater than the size or if the Datum is not of the
 		/// Pointer DatumType.
@@ -445,13 +775,21 @@ namespace FieaGameEngine
 		/// <param name="value">The RTTI* value to be set at the specified index.</param>
 		/// <param name="index">The index referring to the value to be changed in the existing datum.</param>
 		void SetRTTI(RTTI* value, size_t index = 0);
+		/// <summary>
+		/// Sets the specified index in the array with the provided ScopeHandle value. Index is 0 by default. Does not work if the index provided is greater than the size or if the Datum is not of the
+		/// Handle DatumType.
+		/// </summary>
+		/// <param name="value">The ScopeHandle value to be set at the specified index.</param>
+		/// <param name="index">The index referring to the value to be changed in the existing datum.</param>
+		void SetHandle(ScopeHandle value, size_t index = 0);
 		private:
 		void SetScope(Scope* value, size_t index = 0);
 		public:
 		//Get functions
 		/// <summary>
 		/// Gets the non-const Int value stored at the specified index in the array. Index is 0 by default. Does not work if the index provided is greater than the size or if the Datum is not of the
-		/// Integer DatumType.
+		/// Integer DatumType. As the returned reference may be written through at any later time, the Datum's elements are left out of the owning scope's structural hash from then on, which is also true
+		/// of the other non-const Get functions, except for GetRTTI, whose elements are never hashed, and GetScope, whose nested scopes hash their own contents.
 		/// </summary>
 		/// <param name="index">The index referring to the value to be retrieved from the Datum.</param>
 		/// <returns>The integer value held within the specified index.</returns>
@@ -491,6 +829,13 @@ namespace FieaGameEngine
 		/// <param name="index">The index referring to the value to be retrieved from the Datum.</param>
 		/// <returns>The RTTI* value held within the specified index.</returns>
 		RTTI*& GetRTTI(size_t index = 0);
+		/// <summary>
+		/// Gets the non-const ScopeHandle value stored at the specified index in the array. Index is 0 by default. Does not work if the index provided is greater than the size or if the Datum is not of the
+		/// Handle DatumType.
+		/// </summary>
+		/// <param name="index">The index referring to the value to be retrieved from the Datum.</param>
+		/// <returns>The ScopeHandle value held within the specified index.</returns>
+		ScopeHandle& GetHandle(size_t index = 0);
 		Scope*& GetScope(size_t index = 0);
 
 		public:
@@ -516,6 +861,13 @@ namespace FieaGameEngine
 		/// <returns>The const string value held within the specified index.</returns>
 		const std::string& GetConstString(size_t index = 0) const;
 		/// <summary>
+		/// Returns a view of the String value stored at the specified index in the array, which works whether or not the Datum is packed. The view is invalidated by any change to the Datum. Does
+		/// not work if the index provided is greater than the size or if the Datum is not of the String DatumType.
+		/// </summary>
+		/// <param name="index">The index referring to the value to be retrieved from the Datum.</param>
+		/// <returns>A view of the string value held within the specified index.</returns>
+		[[nodiscard]] std::string_view GetStringView(size_t index = 0) const;
+		/// <summary>
 		/// Gets the const Vec4 value stored at the specified index in the array. Index is 0 by default. Does not work if the index provided is greater than the size or if the Datum is not of the
 		/// Vector DatumType.
 		/// </summary>
@@ -536,46 +888,72 @@ namespace FieaGameEngine
 		/// <param name="index">The index referring to the value to be retrieved from the Datum.</param>
 		/// <returns>The const RTTI* value held within the specified index.</returns>
 		RTTI*const& GetConstRTTI(size_t index = 0) const;
+		/// <summary>
+		/// Gets the const ScopeHandle value stored at the specified index in the array. Index is 0 by default. Does not work if the index provided is greater than the size or if the Datum is not of the
+		/// Handle DatumType.
+		/// </summary>
+		/// <param name="index">The index referring to the value to be retrieved from the Datum.</param>
+		/// <returns>The const ScopeHandle value held within the specified index.</returns>
+		const ScopeHandle& GetConstHandle(size_t index = 0) const;
+		/// <summary>
+		/// Resolves the ScopeHandle stored at the specified index in the array to the scope it refers to. Index is 0 by default. Does not work if the index provided is greater than the size or if the
+		/// Datum is not of the Handle DatumType.
+		/// </summary>
+		/// <param name="index">The index referring to the handle to be resolved.</param>
+		/// <returns>A pointer to the referenced scope, or nullptr if the handle is null or the scope it referred to has been destroyed.</returns>
+		[[nodiscard]] Scope* ResolveHandle(size_t index = 0) const;
 		Scope*const& GetConstScope(size_t index = 0) const;
 
 		public:
 		//PushBack functions
 		/// <summary>
-		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity increases by one to accommodate it. Does not work if Datum type is anything besides Unknown
+		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity grows according to the growth policy to accommodate it. Does not work if Datum type is anything besides Unknown
 		/// or Integer.
 		/// </summary>
 		/// <param name="newElement">The Integer to be pushed to the back of the calling Datum.</param>
 		void PushBack(size_t newElement);
 		/// <summary>
-		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity increases by one to accommodate it. Does not work if Datum type is anything besides Unknown
+		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity grows according to the growth policy to accommodate it. Does not work if Datum type is anything besides Unknown
 		/// or Float.
 		/// </summary>
 		/// <param name="newElement">The Float to be pushed to the back of the calling Datum.</param>
 		void PushBack(float newElement);
 		/// <summary>
-		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity increases by one to accommodate it. Does not work if Datum type is anything besides Unknown
+		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity grows according to the growth policy to accommodate it. Does not work if Datum type is anything besides Unknown
 		/// or String.
 		/// </summary>
 		/// <param name="newElement">The String to be pushed to the back of the calling Datum.</param>
 		void PushBack(const std::string& newElement);
 		/// <summary>
-		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity increases by one to accommodate it. Does not work if Datum type is anything besides Unknown
+		/// Pushes a new value onto the back of the Datum, moving it in rather than copying it. If size is equal to capacity, capacity grows according to the growth policy to accommodate it. Does not work
+		/// if Datum type is anything besides Unknown or String.
+		/// </summary>
+		/// <param name="newElement">The String to be moved onto the back of the calling Datum.</param>
+		void PushBack(std::string&& newElement);
+		/// <summary>
+		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity grows according to the growth policy to accommodate it. Does not work if Datum type is anything besides Unknown
 		/// or Vector.
 		/// </summary>
 		/// <param name="newElement">The Vec4 to be pushed to the back of the calling Datum.</param>
 		void PushBack(glm::vec4 newElement);
 		/// <summary>
-		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity increases by one to accommodate it. Does not work if Datum type is anything besides Unknown
+		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity grows according to the growth policy to accommodate it. Does not work if Datum type is anything besides Unknown
 		/// or Matrix.
 		/// </summary>
 		/// <param name="newElement">The Mat4 to be pushed to the back of the calling Datum.</param>
 		void PushBack(const glm::mat4& newElement);
 		/// <summary>
-		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity increases by one to accommodate it. Does not work if Datum type is anything besides Unknown
+		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity grows according to the growth policy to accommodate it. Does not work if Datum type is anything besides Unknown
 		/// or Pointer.
 		/// </summary>
 		/// <param name="newElement">The RTTI* to be pushed to the back of the calling Datum.</param>
 		void PushBack(RTTI* newElement);
+		/// <summary>
+		/// Pushes a new value onto the back of the Datum. If size is equal to capacity, capacity grows according to the growth policy to accommodate it. Does not work if Datum type is anything besides Unknown
+		/// or Handle.
+		/// </summary>
+		/// <param name="newElement">The ScopeHandle to be pushed to the back of the calling Datum.</param>
+		void PushBack(ScopeHandle newElement);
 		private:
 		void PushBack(Scope* newElement);
 		
@@ -755,6 +1133,13 @@ namespace FieaGameEngine
 		/// <returns>A boolean indicating whether the element was found and removed.</returns>
 		/// <param name="value">The RTTI* value that should be searched for and removed.</param>
 		bool Remove(RTTI* value);
+		/// <summary>
+		/// Removes the first ScopeHandle with a specified value from the Datum. Does not work if the Datum is empty, not of the Handle type, or the element is not inside it.
+		/// Decrements size by one if successful without affecting capacity.
+		/// </summary>
+		/// <returns>A boolean indicating whether the element was found and removed.</returns>
+		/// <param name="value">The ScopeHandle value that should be searched for and removed.</param>
+		bool Remove(ScopeHandle value);
 
 		/// <summary>
 		/// Removes the value at the corresponding index from the Datum. Does not work if the index exceeds or is equal to the size of the Datum.
@@ -807,6 +1192,13 @@ namespace FieaGameEngine
 		/// <returns>A size_t indicating what index the target value was found at, set to the end of the Datum if not found.</returns>
 		/// <param name ="value">RTTI* value to be searched for within the Datum.</param>
 		size_t Find(RTTI* value) const;
+		/// <summary>
+		/// Searches for a ScopeHandle in the Datum with the provided value. Does not work if Datum is empty or Datum Type is not Handle. If found, returns a
+		/// size_t with the target value, setting the size_t to the size of the Datum otherwise.
+		/// </summary>
+		/// <returns>A size_t indicating what index the target value was found at, set to the end of the Datum if not found.</returns>
+		/// <param name ="value">ScopeHandle value to be searched for within the Datum.</param>
+		size_t Find(ScopeHandle value) const;
 
 		//String functions
 		/// <summary>
@@ -819,16 +1211,46 @@ namespace FieaGameEngine
 		/// <param name="index">The index of the target element in the Datum.</param>
 		std::string ToString(size_t index = 0) const;
 		/// <summary>
+		/// Appends the string form of the element at the provided index onto the provided buffer, as ToString would return it, without allocating anything besides the buffer's own growth. Numbers are
+		/// written in their shortest form that parses back to the same value, so the output is always accepted by SetFromString. Appends nothing if the index is out of bounds or the Datum is a Table.
+		/// </summary>
+		/// <param name="buffer">The buffer the element is appended onto.</param>
+		/// <param name="index">The index of the target element in the Datum.</param>
+		void ToChars(std::string& buffer, size_t index = 0) const;
+		/// <summary>
+		/// Appends the string form of every element of the Datum onto the provided buffer, separated by ", ", in the form read back by SetAllFromString. Does not work for String, Pointer or Table
+		/// datums, whose elements could not be told apart when read back.
+		/// </summary>
+		/// <param name="buffer">The buffer the elements are appended onto.</param>
+		void WriteAll(std::string& buffer) const;
+		/// <summary>
 		/// Accepts a string, then attempts to set a value at the specified index based on its value. On failure, false is returned. Does not work if the string represents a value of a type different
-		/// from the Datum, or if the string is not formatted according to the specific data type's string representation format.
+		/// from the Datum, or if the string is not formatted according to the specific data type's string representation format. Numbers are parsed without regard to locale, and anything following
+		/// the element's own text is ignored.
 		/// </summary>
 		/// <returns>A bool specifying whether the set succeeded.</returns>
 		/// <param name="value">The char* corresponding to the user-provided.</param>
 		/// <param name="index">The index of the target element in the Datum.</param>
 		bool SetFromString(const char* value, size_t index = 0);
+		/// <summary>
+		/// Parses every element held in the provided text into the Datum, in the same formats accepted by SetFromString, with elements separated by whitespace and optionally a comma, such as
+		/// "1.5, 2, 3". An internal Datum is replaced by the parsed elements, growing as needed; an external Datum has its elements overwritten in place, and parsing stops once it is full. Parsing
+		/// also stops at the first malformed element, with the elements before it kept. Does not work for String, Pointer or Table datums, whose text may not be split into elements.
+		/// </summary>
+		/// <param name="values">The text holding the elements to parse.</param>
+		/// <returns>The number of elements parsed.</returns>
+		size_t SetAllFromString(std::string_view values);
 
 		bool IsExternalStorage();
 
+		/// <summary>
+		/// Computes a hash of the Datum's type, size and elements. Datums that compare equal by element always produce the same hash, so differing hashes prove two Datums are not equal. Pointer elements
+		/// contribute only their count, since RTTI equality is user defined, Table elements contribute the structural hash of each nested scope, and Handle elements contribute the
+		/// slot and generation they name.
+		/// </summary>
+		/// <returns>A 64-bit hash of the Datum's contents.</returns>
+		[[nodiscard]] std::uint64_t Hash() const;
+
 	private:
 		/// <summary>
 		/// Sets external storage for the calling datum. Provided an array, the element type, and the number of elements for it to hold, the Datum will have external storage set to the array for the
@@ -839,6 +1261,185 @@ namespace FieaGameEngine
 		/// <param name="type">The type of elements stored by the array.</param>
 		void SetStorage(DatumTypes type, void* array, size_t size);
 		void DeepCopy(const Datum& copiedDatum);
+		/// <summary>
+		/// Copies every element of the provided Datum into the internal storage of the calling Datum, regardless of whether the provided Datum stores its elements externally. Table elements are not copied, as
+		/// nested Scopes are cloned by their owning Scope.
+		/// </summary>
+		/// <param name="copiedDatum">The Datum whose elements are copied.</param>
+		void CopyElements(const Datum& copiedDatum);
+		/// <summary>
+		/// Compares the type, size and elements of the calling Datum against the provided Datum, without regard to whether either stores its elements externally.
+		/// </summary>
+		/// <param name="comparedDatum">The Datum being compared to the calling Datum.</param>
+		/// <returns>A boolean indicating whether or not the two Datums hold equal elements.</returns>
+		[[nodiscard]] bool ElementsEqual(const Datum& comparedDatum) const;
+		/// <summary>
+		/// Compares the provided range of elements of the calling Datum against the same range of the provided Datum, switching on their type once. Both Datums must have the same type and hold
+		/// every element of the range.
+		/// </summary>
+		/// <param name="comparedDatum">The Datum being compared to the calling Datum.</param>
+		/// <param name="first">The index of the first element compared.</param>
+		/// <param name="count">The number of elements compared.</param>
+		/// <returns>A boolean indicating whether or not the two ranges hold equal elements.</returns>
+		[[nodiscard]] bool ElementsEqual(const Datum& comparedDatum, size_t first, size_t count) const;
+		/// <summary>
+		/// Informs the scope that holds the calling Datum, if any, that the Datum may have been modified, so that cached state such as its structural hash can be invalidated and the change can be journaled.
+		/// Called by every function that modifies the Datum or returns a mutable reference into it, once that function has validated its arguments, so that a call that throws leaves no trace in the scope.
+		/// </summary>
+		/// <param name="index">The index of the element that may have changed, or SIZE_MAX if the Datum may have changed as a whole.</param>
+		void NotifyChanged(size_t index = SIZE_MAX);
+		/// <summary>
+		/// Returns a span over every element of the Datum after checking that it holds elements of type T, reporting the entire Datum as changed. Unlike As, the elements are not marked as escaped,
+		/// so this is only for callers within the library that finish writing through the span before they return.
+		/// </summary>
+		/// <returns>A span over the elements of the Datum.</returns>
+		template <typename T>
+		[[nodiscard]] gsl::span<T> Elements();
+		/// <summary>
+		/// Returns a reference to the element at the provided index after checking the index and type, reporting the element as changed. Unlike Get, the elements are not marked as escaped, so this
+		/// is only for callers within the library that finish writing through the reference before they return.
+		/// </summary>
+		/// <param name="index">The index of the element to return.</param>
+		/// <returns>A reference to the element at the provided index.</returns>
+		template <typename T>
+		[[nodiscard]] T& ElementAt(size_t index);
+		/// <summary>
+		/// Returns the capacity a full Datum grows to under the current growth policy. Always greater than the current capacity.
+		/// </summary>
+		[[nodiscard]] size_t GrownCapacity() const;
+		/// <summary>
+		/// Prepares the Datum to have the provided number of elements of the provided type appended in bulk, setting its type if Unknown and reserving space for them, and returns the address of the
+		/// first new element. Throws a runtime error if the Datum has a different type, or is external and lacks room.
+		/// </summary>
+		[[nodiscard]] std::byte* PrepareAppend(DatumTypes type, size_t count);
+		/// <summary>
+		/// Prepares the Datum to have a single element of the provided type pushed onto its back, growing its capacity by the growth policy when full, and returns the address of the new element. The
+		/// element is left unconstructed, for the caller to construct and count.
+		/// </summary>
+		[[nodiscard]] std::byte* PreparePushBack(DatumTypes type);
+		/// <summary>
+		/// An empty value naming an element type, passed by Dispatch to the function it calls.
+		/// </summary>
+		template <typename T>
+		struct ElementTag final
+		{
+			using Type = T;
+		};
+		/// <summary>
+		/// Calls the provided function with the ElementTag of the element type of the provided Datum type, switching on the type once. Generic operations are written once as a function of the tag,
+		/// with if constexpr picking out the types that need handling of their own. Throws a runtime error if the type is Unknown.
+		/// </summary>
+		template <typename Function>
+		static decltype(auto) Dispatch(DatumTypes type, Function&& function);
+		/// <summary>
+		/// Whether or not T is made up entirely of floats, and so may be compared as a run of floats.
+		/// </summary>
+		template <typename T>
+		static constexpr bool IsFloatElement = std::is_same_v<T, float> || std::is_same_v<T, glm::vec2> || std::is_same_v<T, glm::vec3> || std::is_same_v<T, glm::vec4> ||
+			std::is_same_v<T, glm::mat4> || std::is_same_v<T, glm::quat> || std::is_same_v<T, glm::mat4x3>;
+		/// <summary>
+		/// Whether or not T is the element type of a numeric or Handle Datum type, whose elements are plain values that may be converted to and from text.
+		/// </summary>
+		template <typename T>
+		static constexpr bool IsValueElement = !std::is_same_v<T, std::string> && !std::is_same_v<T, RTTI*> && !std::is_same_v<T, Scope*>;
+		/// <summary>
+		/// The text in front of the components of each vector type, as written by glm::to_string.
+		/// </summary>
+		template <typename T>
+		static constexpr std::string_view VectorPrefix = std::is_same_v<T, glm::vec2> ? "vec2(" : (std::is_same_v<T, glm::vec3> ? "vec3(" : "vec4(");
+		/// <summary>
+		/// Destroys the elements in the provided range of indices, for those types whose elements need destruction.
+		/// </summary>
+		void DestroyElements(size_t first, size_t last);
+		/// <summary>
+		/// Constructs new elements in the provided range of indices. Strings are empty, Quaternions and Transforms are the identity, and every other element is zeroed.
+		/// </summary>
+		void ConstructElements(size_t first, size_t last);
+		/// <summary>
+		/// Parses a single numeric or Handle element from the front of the text into the provided element, returning the position just past it, or nullptr if the text does not begin with an element.
+		/// Leaves the element in an unspecified state on failure.
+		/// </summary>
+		template <typename T>
+		[[nodiscard]] static const char* ParseElement(const char* first, const char* last, T& element);
+		/// <summary>
+		/// Matches the provided literal at the front of the text, returning the position just past it, or nullptr if it does not match. Each space in the literal matches any run of whitespace,
+		/// including none, as in a scanf format.
+		/// </summary>
+		[[nodiscard]] static const char* ParseLiteral(const char* first, const char* last, std::string_view literal);
+		/// <summary>
+		/// Parses a list of floats separated by commas from the front of the text, as found in the Vector and Matrix formats, returning the position just past the last, or nullptr on failure.
+		/// </summary>
+		[[nodiscard]] static const char* ParseFloats(const char* first, const char* last, float* values, size_t count);
+		/// <summary>
+		/// Returns the position of the first character of the text that is not whitespace.
+		/// </summary>
+		[[nodiscard]] static const char* SkipSpaces(const char* first, const char* last);
+		/// <summary>
+		/// Writes the provided numeric or Handle element into the provided characters, which must hold at least MaxElementChars, returning the position just past the last character written.
+		/// </summary>
+		template <typename T>
+		[[nodiscard]] static char* FormatElement(const T& element, char* first);
+		/// <summary>
+		/// Writes a list of floats separated by ", ", as found in the Vector and Matrix formats, returning the position just past the last character written.
+		/// </summary>
+		[[nodiscard]] static char* FormatFloats(const float* values, size_t count, char* first);
+		/// <summary>
+		/// The most characters FormatElement writes for a single element, reached by a Matrix whose every component needs the longest shortest form of a float.
+		/// </summary>
+		static constexpr size_t MaxElementChars = 320;
+		/// <summary>
+		/// The most characters the shortest form of a single float takes, as in "-1.17549435e-38".
+		/// </summary>
+		static constexpr size_t MaxFloatChars = 16;
+		/// <summary>
+		/// Compares two runs of floats with IEEE equality, as comparing each pair with == would, several at a time where SIMD is available.
+		/// </summary>
+		[[nodiscard]] static bool FloatsEqual(const float* left, const float* right, size_t count);
+		/// <summary>
+		/// Returns the index of the first of the provided elements, each made up of the provided number of float components, that equals value in every component, or count if there is none.
+		/// </summary>
+		[[nodiscard]] static size_t FindFloats(const float* elements, size_t count, const float* value, size_t components);
+		/// <summary>
+		/// Returns the index of the first of the provided 64 bit words that equals value, or count if there is none. The words need not be aligned.
+		/// </summary>
+		[[nodiscard]] static size_t FindWords(const void* words, size_t count, std::uint64_t value);
+		/// <summary>
+		/// Returns the index of the lowest set bit of a nonzero SIMD comparison mask.
+		/// </summary>
+		[[nodiscard]] static size_t LowestSetBit(int mask);
+		/// <summary>
+		/// The location of a single element within the characters of a packed String Datum.
+		/// </summary>
+		struct PackedString final
+		{
+			size_t Offset;
+			size_t Length;
+		};
+		/// <summary>
+		/// Allocates a block for the provided number of packed elements, holding the provided number of characters between them.
+		/// </summary>
+		[[nodiscard]] static std::byte* AllocatePacked(size_t count, size_t characters);
+		/// <summary>
+		/// Returns the characters of a packed String Datum, which follow its PackedStrings.
+		/// </summary>
+		[[nodiscard]] const char* PackedCharacters() const;
+		/// <summary>
+		/// Returns the size of the block of a packed String Datum in bytes.
+		/// </summary>
+		[[nodiscard]] size_t PackedBytes() const;
+		/// <summary>
+		/// Returns a boolean indicating whether or not the elements of the Datum are held in its inline storage.
+		/// </summary>
+		[[nodiscard]] bool IsInline() const;
+		/// <summary>
+		/// Returns the number of elements of the provided type that fit in the inline storage of a Datum, which is zero for Strings and Matrices.
+		/// </summary>
+		[[nodiscard]] static size_t InlineCapacity(DatumTypes type);
+		/// <summary>
+		/// Moves the elements of an internal Datum into storage for the provided capacity, keeping as many elements as fit. Capacities that fit are held inline, capacities that do not are allocated,
+		/// and a capacity of zero releases the storage entirely. Does not construct or destroy any element, though Strings are move constructed into a new block rather than copied bytewise.
+		/// </summary>
+		void Reallocate(size_t capacity);
 
 		/// <summary>
 		/// A union representing the different types of variables that may be held by the Datum. After choosing a type, the type may not be changed for a Datum.
@@ -848,10 +1449,20 @@ namespace FieaGameEngine
 			size_t* i;
 			float* f;
 			std::string* s;
+			PackedString* ps;
 			glm::vec4* v;
 			glm::mat4* m;
 			RTTI** p;
 			Scope** t;
+			ScopeHandle* h;
+			std::int32_t* i32;
+			std::int64_t* i64;
+			double* d;
+			bool* b;
+			glm::vec2* v2;
+			glm::vec3* v3;
+			glm::quat* q;
+			glm::mat4x3* a;
 			void* vp = nullptr;
 		};
 
@@ -877,9 +1488,48 @@ namespace FieaGameEngine
 		/// </summary>
 		bool IsExternal{ false };
 		/// <summary>
+		/// A boolean indicating whether or not the elements of a String Datum are packed into a single block of PackedStrings followed by their characters, rather than held as std::strings.
+		/// </summary>
+		bool Packed{ false };
+		/// <summary>
+		/// Whether or not a mutable reference or span into the Datum's elements has ever been returned, through which the elements may since have been written without the owning scope's knowledge.
+		/// Such elements contribute only their type and count to the scope's structural hash, which is then marked as inexact. Never cleared, as references to inline elements stay valid for the life
+		/// of the Datum, and carried along when the Datum is moved.
+		/// </summary>
+		bool ElementsEscaped{ false };
+		/// <summary>
+		/// The scope that holds the calling Datum, or nullptr if the Datum is not held by a scope. Not copied or moved along with the Datum's elements.
+		/// </summary>
+		Scope* Owner{ nullptr };
+		/// <summary>
+		/// The number of bytes of inline storage in each Datum, enough to hold a single Vector.
+		/// </summary>
+		static constexpr size_t InlineBytes = sizeof(glm::vec4);
+		/// <summary>
+		/// Storage for the elements of an internal Datum whose capacity fits inside of the Datum itself, such as a single Integer, Float, Pointer or Vector. Such Datums neither allocate nor chase a
+		/// pointer to read their elements. Strings, Matrices and Transforms are never held inline, so inline elements may always be copied bytewise.
+		/// </summary>
+		alignas(glm::vec4) std::byte InlineStorage[InlineBytes]{};
+		/// <summary>
+		/// The growth policy used by every Datum.
+		/// </summary>
+		static GrowthPolicy Growth;
+		/// <summary>
 		/// A lookup table indicating the sizes of each data type in bytes. Indices correspond to those assigned to the Data Type of the Datum.
 		/// </summary>
-		static constexpr size_t TypeSize[8] = {0, sizeof(size_t), sizeof(float), sizeof(std::string), sizeof(glm::vec4), sizeof(glm::mat4), sizeof(RTTI*), sizeof(Scope*)};
+		static constexpr size_t TypeSize[17] = {0, sizeof(size_t), sizeof(float), sizeof(std::string), sizeof(glm::vec4), sizeof(glm::mat4), sizeof(RTTI*), sizeof(Scope*), sizeof(ScopeHandle),
+			sizeof(std::int32_t), sizeof(std::int64_t), sizeof(double), sizeof(bool), sizeof(glm::vec2), sizeof(glm::vec3), sizeof(glm::quat), sizeof(glm::mat4x3)};
+		/// <summary>
+		/// A lookup table indicating the alignment of the allocated storage of each data type in bytes, so that arrays of Vectors may be read with aligned SIMD loads and each Matrix starts its own cache
+		/// line. Indices correspond to those assigned to the Data Type of the Datum.
+		/// </summary>
+		static constexpr size_t TypeAlignment[17] = {AlignedMemory::MinimumAlignment, AlignedMemory::AlignmentOf<size_t>(), AlignedMemory::AlignmentOf<float>(),
+			AlignedMemory::AlignmentOf<std::string>(), AlignedMemory::AlignmentOf<glm::vec4>(), AlignedMemory::AlignmentOf<glm::mat4>(), AlignedMemory::AlignmentOf<RTTI*>(),
+			AlignedMemory::AlignmentOf<Scope*>(), AlignedMemory::AlignmentOf<ScopeHandle>(), AlignedMemory::AlignmentOf<std::int32_t>(), AlignedMemory::AlignmentOf<std::int64_t>(),
+			AlignedMemory::AlignmentOf<double>(), AlignedMemory::AlignmentOf<bool>(), AlignedMemory::AlignmentOf<glm::vec2>(), AlignedMemory::AlignmentOf<glm::vec3>(),
+			AlignedMemory::AlignmentOf<glm::quat>(), AlignedMemory::AlignmentOf<glm::mat4x3>()};
 	};
 };
-//#include "Datum.cpp"
\ No newline at end of file
+//#include "Datum.cpp"
+
+#include "Datum.inl"
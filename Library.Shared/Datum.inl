@@ -0,0 +1,320 @@
+#include "Datum.h"
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	inline constexpr Datum::DatumTypes Datum::TypeOf()
+	{
+		static_assert(IsElementType<T>, "T must be the element type of a Datum type.");
+		if constexpr (std::is_same_v<T, size_t>)
+		{
+			return DatumTypes::Integer;
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			return DatumTypes::Float;
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			return DatumTypes::String;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec4>)
+		{
+			return DatumTypes::Vector;
+		}
+		else if constexpr (std::is_same_v<T, glm::mat4>)
+		{
+			return DatumTypes::Matrix;
+		}
+		else if constexpr (std::is_same_v<T, RTTI*>)
+		{
+			return DatumTypes::Pointer;
+		}
+		else if constexpr (std::is_same_v<T, Scope*>)
+		{
+			return DatumTypes::Table;
+		}
+		else if constexpr (std::is_same_v<T, ScopeHandle>)
+		{
+			return DatumTypes::Handle;
+		}
+		else if constexpr (std::is_same_v<T, std::int32_t>)
+		{
+			return DatumTypes::Int32;
+		}
+		else if constexpr (std::is_same_v<T, std::int64_t>)
+		{
+			return DatumTypes::Int64;
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			return DatumTypes::Double;
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			return DatumTypes::Boolean;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec2>)
+		{
+			return DatumTypes::Vector2;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec3>)
+		{
+			return DatumTypes::Vector3;
+		}
+		else if constexpr (std::is_same_v<T, glm::quat>)
+		{
+			return DatumTypes::Quaternion;
+		}
+		else
+		{
+			return DatumTypes::Transform;
+		}
+	}
+
+	template <typename Visitor>
+	inline decltype(auto) Datum::Visit(Visitor&& visitor)
+	{
+		return Dispatch(DataType, [this, &visitor](auto tag) -> decltype(auto)
+		{
+			using T = typename decltype(tag)::Type;
+			if constexpr (std::is_same_v<T, Scope*>)
+			{
+				NotifyChanged();
+				return visitor(static_cast<const Datum&>(*this).As<T>());
+			}
+			else
+			{
+				return visitor(As<T>());
+			}
+		});
+	}
+
+	template <typename Visitor>
+	inline decltype(auto) Datum::Visit(Visitor&& visitor) const
+	{
+		return Dispatch(DataType, [this, &visitor](auto tag) -> decltype(auto)
+		{
+			return visitor(As<typename decltype(tag)::Type>());
+		});
+	}
+
+	template <typename Function>
+	inline decltype(auto) Datum::Dispatch(DatumTypes type, Function&& function)
+	{
+		static_assert(std::tuple_size_v<ElementTypes> == std::size(TypeSize), "Every Datum type must have both an element type and a size.");
+		switch (type)
+		{
+		case DatumTypes::Integer:
+			return function(ElementTag<ElementType<DatumTypes::Integer>>{});
+		case DatumTypes::Float:
+			return function(ElementTag<ElementType<DatumTypes::Float>>{});
+		case DatumTypes::String:
+			return function(ElementTag<ElementType<DatumTypes::String>>{});
+		case DatumTypes::Vector:
+			return function(ElementTag<ElementType<DatumTypes::Vector>>{});
+		case DatumTypes::Matrix:
+			return function(ElementTag<ElementType<DatumTypes::Matrix>>{});
+		case DatumTypes::Pointer:
+			return function(ElementTag<ElementType<DatumTypes::Pointer>>{});
+		case DatumTypes::Table:
+			return function(ElementTag<ElementType<DatumTypes::Table>>{});
+		case DatumTypes::Handle:
+			return function(ElementTag<ElementType<DatumTypes::Handle>>{});
+		case DatumTypes::Int32:
+			return function(ElementTag<ElementType<DatumTypes::Int32>>{});
+		case DatumTypes::Int64:
+			return function(ElementTag<ElementType<DatumTypes::Int64>>{});
+		case DatumTypes::Double:
+			return function(ElementTag<ElementType<DatumTypes::Double>>{});
+		case DatumTypes::Boolean:
+			return function(ElementTag<ElementType<DatumTypes::Boolean>>{});
+		case DatumTypes::Vector2:
+			return function(ElementTag<ElementType<DatumTypes::Vector2>>{});
+		case DatumTypes::Vector3:
+			return function(ElementTag<ElementType<DatumTypes::Vector3>>{});
+		case DatumTypes::Quaternion:
+			return function(ElementTag<ElementType<DatumTypes::Quaternion>>{});
+		case DatumTypes::Transform:
+			return function(ElementTag<ElementType<DatumTypes::Transform>>{});
+		default:
+			throw std::runtime_error("Cannot dispatch on a Datum of unknown type!");
+		}
+	}
+
+	template <typename T>
+	inline gsl::span<T> Datum::As()
+	{
+		static_assert(!std::is_same_v<T, Scope*>, "Table elements may only be changed through their parent scope.");
+		gsl::span<T> elements = Elements<T>();
+		ElementsEscaped = true;
+		return elements;
+	}
+
+	template <typename T>
+	inline gsl::span<const T> Datum::As() const
+	{
+		if (DataType != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+		if constexpr (std::is_same_v<T, std::string>)
+		{
+			if (Packed)
+			{
+				throw std::runtime_error("Packed string datums must be read with GetStringView!");
+			}
+		}
+		return gsl::span<const T>(static_cast<const T*>(Data.vp), CurrentSize);
+	}
+
+	template <typename T>
+	inline T& Datum::Get(size_t index)
+	{
+		static_assert(!std::is_same_v<T, Scope*>, "Table elements may only be changed through their parent scope.");
+		T& element = ElementAt<T>(index);
+		ElementsEscaped = true;
+		return element;
+	}
+
+	template <typename T>
+	inline const T& Datum::Get(size_t index) const
+	{
+		if (index >= CurrentSize)
+		{
+			throw std::runtime_error("Cannot access value at index that exceeds array size!");
+		}
+		if (DataType != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+		if constexpr (std::is_same_v<T, std::string>)
+		{
+			if (Packed)
+			{
+				throw std::runtime_error("Packed string datums must be read with GetStringView!");
+			}
+		}
+		return static_cast<const T*>(Data.vp)[index];
+	}
+
+	template <typename T>
+	inline gsl::span<T> Datum::Elements()
+	{
+		if (DataType != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+		NotifyChanged();
+		if constexpr (std::is_same_v<T, std::string>)
+		{
+			Unpack();
+		}
+		return gsl::span<T>(static_cast<T*>(Data.vp), CurrentSize);
+	}
+
+	template <typename T>
+	inline T& Datum::ElementAt(size_t index)
+	{
+		if (index >= CurrentSize)
+		{
+			throw std::runtime_error("Cannot access value at index that exceeds array size!");
+		}
+		if (DataType != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot access value of type that differs from that of the Datum!");
+		}
+		NotifyChanged(index);
+		if constexpr (std::is_same_v<T, std::string>)
+		{
+			Unpack();
+		}
+		return static_cast<T*>(Data.vp)[index];
+	}
+
+	template <typename T>
+	inline void Datum::Set(const std::enable_if_t<IsElementType<T>, T>& value, size_t index)
+	{
+		ElementAt<T>(index) = value;
+	}
+
+	template <typename T>
+	inline void Datum::Set(std::enable_if_t<IsElementType<T>, T>&& value, size_t index)
+	{
+		ElementAt<T>(index) = std::move(value);
+	}
+
+	template <typename T>
+	inline void Datum::PushBack(const std::enable_if_t<IsElementType<T>, T>& value)
+	{
+		static_assert(!std::is_same_v<T, Scope*>, "Scopes may only be added to a Table through their parent scope.");
+		if constexpr (IsCompactType<T>)
+		{
+			new(PreparePushBack(TypeOf<T>())) T(value);
+			CurrentSize++;
+		}
+		else
+		{
+			PushBack(value); //Resolves to the non-template overload for T, as the template parameter can not be deduced.
+		}
+	}
+
+	template <typename T>
+	inline void Datum::PushBack(std::enable_if_t<IsElementType<T>, T>&& value)
+	{
+		static_assert(!std::is_same_v<T, Scope*>, "Scopes may only be added to a Table through their parent scope.");
+		if constexpr (IsCompactType<T>)
+		{
+			new(PreparePushBack(TypeOf<T>())) T(std::move(value));
+			CurrentSize++;
+		}
+		else
+		{
+			PushBack(std::move(value));
+		}
+	}
+
+	template <typename T, typename... Arguments>
+	inline T& Datum::EmplaceBack(Arguments&&... arguments)
+	{
+		static_assert(IsElementType<T>, "T must be the element type of a Datum type.");
+		static_assert(!std::is_same_v<T, Scope*>, "Scopes may only be added to a Table through their parent scope.");
+		T* element = new(PreparePushBack(TypeOf<T>())) T(std::forward<Arguments>(arguments)...);
+		CurrentSize++;
+		ElementsEscaped = true;
+		return *element;
+	}
+
+	template <typename T>
+	inline size_t Datum::Find(const std::enable_if_t<IsElementType<T>, T>& value) const
+	{
+		if constexpr (IsCompactType<T>)
+		{
+			for (const T& element : As<T>())
+			{
+				if (element == value)
+				{
+					return static_cast<size_t>(&element - static_cast<const T*>(Data.vp));
+				}
+			}
+			return CurrentSize;
+		}
+		else
+		{
+			return Find(value);
+		}
+	}
+
+	template <typename T>
+	inline void Datum::Append(gsl::span<const std::enable_if_t<IsCompactType<T>, T>> values)
+	{
+		memcpy(PrepareAppend(TypeOf<T>(), values.size()), values.data(), values.size_bytes());
+		CurrentSize += values.size();
+	}
+
+	template <typename T>
+	inline void Datum::SetStorage(std::enable_if_t<IsCompactType<T>, T>* elementArray, size_t elements)
+	{
+		SetStorage(TypeOf<T>(), elementArray, elements);
+	}
+}
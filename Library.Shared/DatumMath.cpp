@@ -0,0 +1,574 @@
+#include "DatumMath.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/// <summary>
+/// Method definitions to support the DatumMath class.
+/// </summary>
+namespace FieaGameEngine
+{
+	void DatumMath::Add(Datum& target, const Datum& operand)
+	{
+		Apply(Operation::Add, target, operand, nullptr);
+	}
+
+	void DatumMath::Multiply(Datum& target, const Datum& operand)
+	{
+		Apply(Operation::Multiply, target, operand, nullptr);
+	}
+
+	void DatumMath::Divide(Datum& target, const Datum& operand)
+	{
+		Apply(Operation::Divide, target, operand, nullptr);
+	}
+
+	void DatumMath::Clamp(Datum& target, const Datum& low, const Datum& high)
+	{
+		Apply(Operation::Clamp, target, low, &high);
+	}
+
+	void DatumMath::MultiplyAdd(Datum& target, const Datum& multiplier, const Datum& addend)
+	{
+		Apply(Operation::MultiplyAdd, target, multiplier, &addend);
+	}
+
+	void DatumMath::Compose(Datum& target, const Datum& outer)
+	{
+		if (target.Type() != Datum::DatumTypes::Transform)
+		{
+			throw std::runtime_error("DatumMath only composes Transform datums!");
+		}
+		const size_t outerStride = PrepareTransforms(outer, target);
+		gsl::span<glm::mat4x3> transforms = target.Elements<glm::mat4x3>();
+		ComposeTransforms(reinterpret_cast<float*>(transforms.data()), transforms.size(), reinterpret_cast<const float*>(outer.As<glm::mat4x3>().data()), outerStride);
+	}
+
+	void DatumMath::Invert(Datum& target)
+	{
+		if (target.Type() != Datum::DatumTypes::Transform)
+		{
+			throw std::runtime_error("DatumMath only inverts Transform datums!");
+		}
+		gsl::span<glm::mat4x3> transforms = target.Elements<glm::mat4x3>();
+		InvertTransforms(reinterpret_cast<float*>(transforms.data()), transforms.size());
+	}
+
+	void DatumMath::TransformPoints(Datum& points, const Datum& transforms)
+	{
+		if (points.Type() != Datum::DatumTypes::Vector3)
+		{
+			throw std::runtime_error("DatumMath only transforms the points of Vector3 datums!");
+		}
+		const size_t transformStride = PrepareTransforms(transforms, points);
+		gsl::span<glm::vec3> vectors = points.Elements<glm::vec3>();
+		TransformVectors(reinterpret_cast<float*>(vectors.data()), vectors.size(), reinterpret_cast<const float*>(transforms.As<glm::mat4x3>().data()), transformStride);
+	}
+
+	void DatumMath::Apply(Operation operation, Datum& target, const Datum& first, const Datum* second)
+	{
+		const Datum::DatumTypes type = target.Type();
+		if (type != Datum::DatumTypes::Integer && type != Datum::DatumTypes::Float && type != Datum::DatumTypes::Vector)
+		{
+			throw std::runtime_error("DatumMath only operates on Integer, Float and Vector datums!");
+		}
+
+		Operand firstOperand;
+		Operand secondOperand;
+		Prepare(firstOperand, first, target);
+		if (second != nullptr)
+		{
+			Prepare(secondOperand, *second, target);
+		}
+
+		if (type == Datum::DatumTypes::Integer)
+		{
+			if (operation == Operation::Divide)
+			{
+				for (size_t divisor : first.As<size_t>())
+				{
+					if (divisor == 0)
+					{
+						throw std::runtime_error("Cannot divide by zero!"); //Checked before anything is written, so the target is left as it was.
+					}
+				}
+			}
+
+			gsl::span<size_t> elements = target.Elements<size_t>();
+			switch (operation)
+			{
+			case Operation::Add:
+				ApplyIntegers<Operation::Add>(elements.data(), elements.size(), firstOperand, secondOperand);
+				break;
+			case Operation::Multiply:
+				ApplyIntegers<Operation::Multiply>(elements.data(), elements.size(), firstOperand, secondOperand);
+				break;
+			case Operation::Divide:
+				ApplyIntegers<Operation::Divide>(elements.data(), elements.size(), firstOperand, secondOperand);
+				break;
+			case Operation::Clamp:
+				ApplyIntegers<Operation::Clamp>(elements.data(), elements.size(), firstOperand, secondOperand);
+				break;
+			case Operation::MultiplyAdd:
+				ApplyIntegers<Operation::MultiplyAdd>(elements.data(), elements.size(), firstOperand, secondOperand);
+				break;
+			}
+			return;
+		}
+
+		//Vectors are operated on as a flat array of their components.
+		float* elements;
+		size_t count;
+		if (type == Datum::DatumTypes::Float)
+		{
+			gsl::span<float> floats = target.Elements<float>();
+			elements = floats.data();
+			count = floats.size();
+		}
+		else
+		{
+			gsl::span<glm::vec4> vectors = target.Elements<glm::vec4>();
+			elements = reinterpret_cast<float*>(vectors.data());
+			count = vectors.size() * (sizeof(glm::vec4) / sizeof(float));
+		}
+
+		switch (operation)
+		{
+		case Operation::Add:
+			ApplyFloats<Operation::Add>(elements, count, firstOperand, secondOperand);
+			break;
+		case Operation::Multiply:
+			ApplyFloats<Operation::Multiply>(elements, count, firstOperand, secondOperand);
+			break;
+		case Operation::Divide:
+			ApplyFloats<Operation::Divide>(elements, count, firstOperand, secondOperand);
+			break;
+		case Operation::Clamp:
+			ApplyFloats<Operation::Clamp>(elements, count, firstOperand, secondOperand);
+			break;
+		case Operation::MultiplyAdd:
+			ApplyFloats<Operation::MultiplyAdd>(elements, count, firstOperand, secondOperand);
+			break;
+		}
+	}
+
+	void DatumMath::Prepare(Operand& operand, const Datum& source, const Datum& target)
+	{
+		const Datum::DatumTypes type = target.Type();
+		const bool scalesVectors = type == Datum::DatumTypes::Vector && source.Type() == Datum::DatumTypes::Float && source.Size() == 1;
+		if (source.Type() != type && !scalesVectors)
+		{
+			throw std::runtime_error("DatumMath operands must have the same type as the target!");
+		}
+
+		if (source.Size() == target.Size() && !scalesVectors)
+		{
+			switch (type)
+			{
+			case Datum::DatumTypes::Integer:
+				operand.Elements = source.As<size_t>().data();
+				break;
+			case Datum::DatumTypes::Float:
+				operand.Elements = source.As<float>().data();
+				break;
+			default:
+				operand.Elements = source.As<glm::vec4>().data();
+				break;
+			}
+			return;
+		}
+
+		if (source.Size() != 1)
+		{
+			throw std::runtime_error("DatumMath operands must hold one element or as many elements as the target!");
+		}
+
+		//The single element is repeated across a whole register, so that kernels treat it like any other operand.
+		const void* element;
+		size_t elementSize;
+		switch (source.Type())
+		{
+		case Datum::DatumTypes::Integer:
+			element = &source.Get<size_t>();
+			elementSize = sizeof(size_t);
+			break;
+		case Datum::DatumTypes::Float:
+			element = &source.Get<float>();
+			elementSize = sizeof(float);
+			break;
+		default:
+			element = &source.Get<glm::vec4>();
+			elementSize = sizeof(glm::vec4);
+			break;
+		}
+		for (size_t offset = 0; offset < PatternBytes; offset += elementSize)
+		{
+			memcpy(operand.Pattern + offset, element, elementSize);
+		}
+		operand.Elements = operand.Pattern;
+		operand.Broadcast = true;
+	}
+
+	size_t DatumMath::PrepareTransforms(const Datum& transforms, const Datum& target)
+	{
+		if (transforms.Type() != Datum::DatumTypes::Transform)
+		{
+			throw std::runtime_error("DatumMath transform operands must be Transform datums!");
+		}
+		if (transforms.Size() == target.Size())
+		{
+			return TransformFloats;
+		}
+		if (transforms.Size() != 1)
+		{
+			throw std::runtime_error("DatumMath operands must hold one element or as many elements as the target!");
+		}
+		return 0; //A single transform is applied to every element by never stepping past it.
+	}
+
+	template <DatumMath::Operation operation>
+	void DatumMath::ApplyFloats(float* target, size_t count, const Operand& first, const Operand& second)
+	{
+		constexpr size_t patternLength = PatternBytes / sizeof(float);
+		const float* firstElements = static_cast<const float*>(first.Elements);
+		const float* secondElements = static_cast<const float*>(second.Elements);
+		size_t i = 0;
+
+#if defined(FIEA_SIMD_AVX2)
+		const __m256 firstPattern = first.Broadcast ? _mm256_load_ps(firstElements) : _mm256_setzero_ps();
+		const __m256 secondPattern = second.Broadcast ? _mm256_load_ps(secondElements) : _mm256_setzero_ps();
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(target + i);
+			const __m256 y = first.Broadcast ? firstPattern : _mm256_loadu_ps(firstElements + i);
+			__m256 result;
+			if constexpr (operation == Operation::Add)
+			{
+				result = _mm256_add_ps(x, y);
+			}
+			else if constexpr (operation == Operation::Multiply)
+			{
+				result = _mm256_mul_ps(x, y);
+			}
+			else if constexpr (operation == Operation::Divide)
+			{
+				result = _mm256_div_ps(x, y);
+			}
+			else
+			{
+				const __m256 z = second.Broadcast ? secondPattern : _mm256_loadu_ps(secondElements + i);
+				if constexpr (operation == Operation::Clamp)
+				{
+					result = _mm256_min_ps(_mm256_max_ps(x, y), z);
+				}
+				else
+				{
+#if defined(FIEA_SIMD_FMA)
+					result = _mm256_fmadd_ps(x, y, z);
+#else
+					result = _mm256_add_ps(_mm256_mul_ps(x, y), z);
+#endif
+				}
+			}
+			_mm256_storeu_ps(target + i, result);
+		}
+#elif defined(FIEA_SIMD_SSE2)
+		const __m128 firstPattern = first.Broadcast ? _mm_load_ps(firstElements) : _mm_setzero_ps();
+		const __m128 secondPattern = second.Broadcast ? _mm_load_ps(secondElements) : _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(target + i);
+			const __m128 y = first.Broadcast ? firstPattern : _mm_loadu_ps(firstElements + i);
+			__m128 result;
+			if constexpr (operation == Operation::Add)
+			{
+				result = _mm_add_ps(x, y);
+			}
+			else if constexpr (operation == Operation::Multiply)
+			{
+				result = _mm_mul_ps(x, y);
+			}
+			else if constexpr (operation == Operation::Divide)
+			{
+				result = _mm_div_ps(x, y);
+			}
+			else
+			{
+				const __m128 z = second.Broadcast ? secondPattern : _mm_loadu_ps(secondElements + i);
+				if constexpr (operation == Operation::Clamp)
+				{
+					result = _mm_min_ps(_mm_max_ps(x, y), z);
+				}
+				else
+				{
+					result = _mm_add_ps(_mm_mul_ps(x, y), z);
+				}
+			}
+			_mm_storeu_ps(target + i, result);
+		}
+#endif
+
+		//The remaining elements, or all of them without SIMD, matching the vector instructions above element for element.
+		for (; i < count; i++)
+		{
+			const float x = target[i];
+			const float y = first.Broadcast ? firstElements[i % patternLength] : firstElements[i];
+			if constexpr (operation == Operation::Add)
+			{
+				target[i] = x + y;
+			}
+			else if constexpr (operation == Operation::Multiply)
+			{
+				target[i] = x * y;
+			}
+			else if constexpr (operation == Operation::Divide)
+			{
+				target[i] = x / y;
+			}
+			else
+			{
+				const float z = second.Broadcast ? secondElements[i % patternLength] : secondElements[i];
+				if constexpr (operation == Operation::Clamp)
+				{
+					const float raised = x > y ? x : y;
+					target[i] = raised < z ? raised : z;
+				}
+				else
+				{
+#if defined(FIEA_SIMD_FMA)
+					target[i] = std::fma(x, y, z);
+#else
+					target[i] = (x * y) + z;
+#endif
+				}
+			}
+		}
+	}
+
+	template <DatumMath::Operation operation>
+	void DatumMath::ApplyIntegers(size_t* target, size_t count, const Operand& first, const Operand& second)
+	{
+		constexpr size_t patternLength = PatternBytes / sizeof(size_t);
+		const size_t* firstElements = static_cast<const size_t*>(first.Elements);
+		const size_t* secondElements = static_cast<const size_t*>(second.Elements);
+		size_t i = 0;
+
+		if constexpr (operation == Operation::Add && sizeof(size_t) == sizeof(std::uint64_t))
+		{
+#if defined(FIEA_SIMD_AVX2)
+			const __m256i pattern = first.Broadcast ? _mm256_load_si256(reinterpret_cast<const __m256i*>(firstElements)) : _mm256_setzero_si256();
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + i));
+				const __m256i y = first.Broadcast ? pattern : _mm256_loadu_si256(reinterpret_cast<const __m256i*>(firstElements + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), _mm256_add_epi64(x, y));
+			}
+#elif defined(FIEA_SIMD_SSE2)
+			const __m128i pattern = first.Broadcast ? _mm_load_si128(reinterpret_cast<const __m128i*>(firstElements)) : _mm_setzero_si128();
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(target + i));
+				const __m128i y = first.Broadcast ? pattern : _mm_loadu_si128(reinterpret_cast<const __m128i*>(firstElements + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(target + i), _mm_add_epi64(x, y));
+			}
+#endif
+		}
+
+		for (; i < count; i++)
+		{
+			const size_t x = target[i];
+			const size_t y = first.Broadcast ? firstElements[i % patternLength] : firstElements[i];
+			if constexpr (operation == Operation::Add)
+			{
+				target[i] = x + y;
+			}
+			else if constexpr (operation == Operation::Multiply)
+			{
+				target[i] = x * y;
+			}
+			else if constexpr (operation == Operation::Divide)
+			{
+				target[i] = x / y;
+			}
+			else
+			{
+				const size_t z = second.Broadcast ? secondElements[i % patternLength] : secondElements[i];
+				if constexpr (operation == Operation::Clamp)
+				{
+					const size_t raised = x > y ? x : y;
+					target[i] = raised < z ? raised : z;
+				}
+				else
+				{
+					target[i] = (x * y) + z;
+				}
+			}
+		}
+	}
+
+	void DatumMath::ComposeTransforms(float* target, size_t count, const float* outer, size_t outerStride)
+	{
+		size_t i = 0;
+#if defined(FIEA_SIMD_AVX2) || defined(FIEA_SIMD_SSE2)
+		__m128 outerColumns[4];
+		for (; i < count; i++)
+		{
+			if (i == 0 || outerStride != 0)
+			{
+				LoadTransform(outer + (i * outerStride), outerColumns);
+			}
+			float* transform = target + (i * TransformFloats);
+			__m128 columns[4];
+			for (size_t column = 0; column < 4; column++)
+			{
+				const float* source = transform + (column * 3);
+				columns[column] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(outerColumns[0], _mm_set1_ps(source[0])), _mm_mul_ps(outerColumns[1], _mm_set1_ps(source[1]))),
+					_mm_mul_ps(outerColumns[2], _mm_set1_ps(source[2])));
+			}
+			columns[3] = _mm_add_ps(columns[3], outerColumns[3]);
+			StoreTransform(transform, columns);
+		}
+#endif
+
+		//Every transform without SIMD, matching the vector instructions above operation for operation.
+		for (; i < count; i++)
+		{
+			const float* outerTransform = outer + (i * outerStride);
+			float* transform = target + (i * TransformFloats);
+			float result[TransformFloats];
+			for (size_t column = 0; column < 4; column++)
+			{
+				const float* source = transform + (column * 3);
+				for (size_t row = 0; row < 3; row++)
+				{
+					result[(column * 3) + row] = (outerTransform[row] * source[0]) + (outerTransform[3 + row] * source[1]) + (outerTransform[6 + row] * source[2]);
+					if (column == 3)
+					{
+						result[(column * 3) + row] += outerTransform[9 + row];
+					}
+				}
+			}
+			memcpy(transform, result, sizeof(result));
+		}
+	}
+
+	void DatumMath::InvertTransforms(float* target, size_t count)
+	{
+		//The inverse of the basis is its adjugate over its determinant, and its rows are the cross products of pairs of its columns. The translation is then carried back through the inverted basis.
+		size_t i = 0;
+#if defined(FIEA_SIMD_AVX2) || defined(FIEA_SIMD_SSE2)
+		const auto cross = [](__m128 left, __m128 right)
+		{
+			const __m128 leftRotated = _mm_shuffle_ps(left, left, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 rightRotated = _mm_shuffle_ps(right, right, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 product = _mm_sub_ps(_mm_mul_ps(left, rightRotated), _mm_mul_ps(leftRotated, right));
+			return _mm_shuffle_ps(product, product, _MM_SHUFFLE(3, 0, 2, 1));
+		};
+		for (; i < count; i++)
+		{
+			float* transform = target + (i * TransformFloats);
+			__m128 columns[4];
+			LoadTransform(transform, columns);
+
+			__m128 rows[4] = { cross(columns[1], columns[2]), cross(columns[2], columns[0]), cross(columns[0], columns[1]), _mm_setzero_ps() };
+			const __m128 products = _mm_mul_ps(columns[0], rows[0]);
+			const __m128 sums = _mm_add_ps(_mm_add_ps(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(3, 0, 2, 1))), _mm_shuffle_ps(products, products, _MM_SHUFFLE(3, 1, 0, 2)));
+			const __m128 inverseDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(0, 0, 0, 0)));
+			rows[0] = _mm_mul_ps(rows[0], inverseDeterminant);
+			rows[1] = _mm_mul_ps(rows[1], inverseDeterminant);
+			rows[2] = _mm_mul_ps(rows[2], inverseDeterminant);
+			_MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+
+			const __m128 translation = columns[3];
+			const __m128 moved = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rows[0], _mm_shuffle_ps(translation, translation, _MM_SHUFFLE(0, 0, 0, 0))),
+				_mm_mul_ps(rows[1], _mm_shuffle_ps(translation, translation, _MM_SHUFFLE(1, 1, 1, 1)))), _mm_mul_ps(rows[2], _mm_shuffle_ps(translation, translation, _MM_SHUFFLE(2, 2, 2, 2))));
+			rows[3] = _mm_xor_ps(moved, _mm_set1_ps(-0.0f));
+			StoreTransform(transform, rows);
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			float* transform = target + (i * TransformFloats);
+			const float* columns[3] = { transform, transform + 3, transform + 6 };
+			float rows[3][3];
+			for (size_t row = 0; row < 3; row++)
+			{
+				const float* left = columns[(row + 1) % 3];
+				const float* right = columns[(row + 2) % 3];
+				rows[row][0] = (left[1] * right[2]) - (left[2] * right[1]);
+				rows[row][1] = (left[2] * right[0]) - (left[0] * right[2]);
+				rows[row][2] = (left[0] * right[1]) - (left[1] * right[0]);
+			}
+			const float inverseDeterminant = 1.0f / ((columns[0][0] * rows[0][0]) + (columns[0][1] * rows[0][1]) + (columns[0][2] * rows[0][2]));
+
+			float result[TransformFloats];
+			for (size_t row = 0; row < 3; row++)
+			{
+				for (size_t column = 0; column < 3; column++)
+				{
+					rows[row][column] *= inverseDeterminant;
+					result[(column * 3) + row] = rows[row][column];
+				}
+				result[9 + row] = -((rows[row][0] * transform[9]) + (rows[row][1] * transform[10]) + (rows[row][2] * transform[11]));
+			}
+			memcpy(transform, result, sizeof(result));
+		}
+	}
+
+	void DatumMath::TransformVectors(float* points, size_t count, const float* transforms, size_t transformStride)
+	{
+		size_t i = 0;
+#if defined(FIEA_SIMD_AVX2) || defined(FIEA_SIMD_SSE2)
+		__m128 columns[4];
+		for (; i < count; i++)
+		{
+			if (i == 0 || transformStride != 0)
+			{
+				LoadTransform(transforms + (i * transformStride), columns);
+			}
+			float* point = points + (i * 3);
+			const __m128 result = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(columns[0], _mm_set1_ps(point[0])), _mm_mul_ps(columns[1], _mm_set1_ps(point[1]))),
+				_mm_mul_ps(columns[2], _mm_set1_ps(point[2]))), columns[3]);
+			_mm_storel_pi(reinterpret_cast<__m64*>(point), result); //Points are packed, so only three floats may be written without touching the next point.
+			_mm_store_ss(point + 2, _mm_movehl_ps(result, result));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			const float* transform = transforms + (i * transformStride);
+			float* point = points + (i * 3);
+			const float x = point[0];
+			const float y = point[1];
+			const float z = point[2];
+			for (size_t row = 0; row < 3; row++)
+			{
+				point[row] = (transform[row] * x) + (transform[3 + row] * y) + (transform[6 + row] * z) + transform[9 + row];
+			}
+		}
+	}
+
+#if defined(FIEA_SIMD_AVX2) || defined(FIEA_SIMD_SSE2)
+	void DatumMath::LoadTransform(const float* transform, __m128 columns[4])
+	{
+		//Each column is loaded as a whole register whose fourth lane, the start of the next column, is ignored. The last column is loaded from one float earlier and rotated into place, so that no
+		//load reads past the end of the transform.
+		columns[0] = _mm_loadu_ps(transform);
+		columns[1] = _mm_loadu_ps(transform + 3);
+		columns[2] = _mm_loadu_ps(transform + 6);
+		const __m128 last = _mm_loadu_ps(transform + 8);
+		columns[3] = _mm_shuffle_ps(last, last, _MM_SHUFFLE(0, 3, 2, 1));
+	}
+
+	void DatumMath::StoreTransform(float* transform, const __m128 columns[4])
+	{
+		//Stored in order, so that the fourth lane of each store is overwritten by the next. The last column is first joined with the end of the third, and so stored from one float earlier.
+		const __m128 joined = _mm_shuffle_ps(columns[2], columns[3], _MM_SHUFFLE(0, 0, 2, 2));
+		_mm_storeu_ps(transform, columns[0]);
+		_mm_storeu_ps(transform + 3, columns[1]);
+		_mm_storeu_ps(transform + 6, columns[2]);
+		_mm_storeu_ps(transform + 8, _mm_shuffle_ps(joined, columns[3], _MM_SHUFFLE(2, 1, 2, 0)));
+	}
+#endif
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include <cstddef>
+#include "Datum.h"
+#include "Simd.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// The DatumMath class, which applies arithmetic to every element of an Integer, Float or Vector Datum in a single call, rather than one element at a time as ActionIncrement and its siblings do.
+	/// Each operand is a Datum holding either a single element, which is applied to every element of the target, or exactly as many elements as the target, which are applied element by element. Operands
+	/// must have the same type as the target, except that a single Float may be applied to every component of a Vector Datum.
+	///
+	/// Float and Vector arithmetic is vectorized with AVX2 when the library is built for it, such as with /arch:AVX2, and with SSE2 otherwise on x86 and x64; other platforms use plain loops. Integer
+	/// addition is vectorized on x64 only, as neither instruction set can multiply, divide or compare unsigned 64 bit integers. Writes are reported to the owning scope as a single change to the whole
+	/// target, as with Datum::As, though the target's elements stay part of its scope's structural hash, as nothing is written to them once the call returns.
+	///
+	/// Transform Datums have kernels of their own, which compose, invert and apply affine transforms. These work on one transform at a time in 128 bit registers under either instruction set, as a 48
+	/// byte transform does not divide into 256 bit registers.
+	/// </summary>
+	class DatumMath final
+	{
+	public:
+		/// <summary>
+		/// Adds the operand to every element of the target.
+		/// </summary>
+		/// <param name="target">The Datum whose elements are changed.</param>
+		/// <param name="operand">A single element added to every element of the target, or one element for each element of the target.</param>
+		static void Add(Datum& target, const Datum& operand);
+		/// <summary>
+		/// Multiplies every element of the target by the operand.
+		/// </summary>
+		/// <param name="target">The Datum whose elements are changed.</param>
+		/// <param name="operand">A single element every element of the target is multiplied by, or one element for each element of the target.</param>
+		static void Multiply(Datum& target, const Datum& operand);
+		/// <summary>
+		/// Divides every element of the target by the operand. Integer division by zero throws a runtime error before any element is changed, while Float division by zero follows IEEE rules.
+		/// </summary>
+		/// <param name="target">The Datum whose elements are changed.</param>
+		/// <param name="operand">A single element every element of the target is divided by, or one element for each element of the target.</param>
+		static void Divide(Datum& target, const Datum& operand);
+		/// <summary>
+		/// Clamps every element of the target, component by component for Vectors, to lie between low and high. Elements are raised to low first and then lowered to high, so high wins where it is below
+		/// low, and NaN elements become low.
+		/// </summary>
+		/// <param name="target">The Datum whose elements are changed.</param>
+		/// <param name="low">The lower bound, either a single element or one element for each element of the target.</param>
+		/// <param name="high">The upper bound, either a single element or one element for each element of the target.</param>
+		static void Clamp(Datum& target, const Datum& low, const Datum& high);
+		/// <summary>
+		/// Multiplies every element of the target by the multiplier and then adds the addend, as target = target * multiplier + addend. Float arithmetic is fused, rounding once, where AVX2 is available.
+		/// </summary>
+		/// <param name="target">The Datum whose elements are changed.</param>
+		/// <param name="multiplier">The multiplier, either a single element or one element for each element of the target.</param>
+		/// <param name="addend">The addend, either a single element or one element for each element of the target.</param>
+		static void MultiplyAdd(Datum& target, const Datum& multiplier, const Datum& addend);
+		/// <summary>
+		/// Composes every transform of the target with the outer transform, as target = outer * target, so that the outer transform is applied after the target's own. Composing local transforms
+		/// with their parent's world transform this way yields their world transforms.
+		/// </summary>
+		/// <param name="target">The Transform Datum whose elements are changed.</param>
+		/// <param name="outer">A single Transform applied after every transform of the target, or one Transform for each transform of the target.</param>
+		static void Compose(Datum& target, const Datum& outer);
+		/// <summary>
+		/// Inverts every transform of the target. Singular transforms follow IEEE rules, becoming infinite or NaN, rather than throwing.
+		/// </summary>
+		/// <param name="target">The Transform Datum whose elements are changed.</param>
+		static void Invert(Datum& target);
+		/// <summary>
+		/// Transforms every point of the target, treating each as a position so that translation applies.
+		/// </summary>
+		/// <param name="points">The Vector3 Datum whose elements are changed.</param>
+		/// <param name="transforms">A single Transform applied to every point, or one Transform for each point.</param>
+		static void TransformPoints(Datum& points, const Datum& transforms);
+
+	private:
+		/// <summary>
+		/// The arithmetic applied by a kernel, chosen at compile time so that each kernel loop does only one thing.
+		/// </summary>
+		enum class Operation
+		{
+			Add,
+			Multiply,
+			Divide,
+			Clamp,
+			MultiplyAdd
+		};
+
+		/// <summary>
+		/// The number of bytes in the widest register used by the kernels, and so in a broadcast pattern.
+		/// </summary>
+		static constexpr size_t PatternBytes = 32;
+
+		/// <summary>
+		/// A validated operand. A single element is broadcast by repeating it across Pattern, which a kernel loads once as a whole register; otherwise Elements points at the operand's own elements.
+		/// </summary>
+		struct Operand final
+		{
+			const void* Elements{ nullptr };
+			bool Broadcast{ false };
+			alignas(PatternBytes) std::byte Pattern[PatternBytes]{};
+		};
+
+		/// <summary>
+		/// The number of floats in a Transform, three for each of its four columns.
+		/// </summary>
+		static constexpr size_t TransformFloats = sizeof(glm::mat4x3) / sizeof(float);
+
+		static void Apply(Operation operation, Datum& target, const Datum& first, const Datum* second);
+		static void Prepare(Operand& operand, const Datum& source, const Datum& target);
+		static size_t PrepareTransforms(const Datum& transforms, const Datum& target);
+
+		static void ComposeTransforms(float* target, size_t count, const float* outer, size_t outerStride);
+		static void InvertTransforms(float* target, size_t count);
+		static void TransformVectors(float* points, size_t count, const float* transforms, size_t transformStride);
+#if defined(FIEA_SIMD_AVX2) || defined(FIEA_SIMD_SSE2)
+		static void LoadTransform(const float* transform, __m128 columns[4]);
+		static void StoreTransform(float* transform, const __m128 columns[4]);
+#endif
+
+		template <Operation operation>
+		static void ApplyFloats(float* target, size_t count, const Operand& first, const Operand& second);
+		template <Operation operation>
+		static void ApplyIntegers(size_t* target, size_t count, const Operand& first, const Operand& second);
+	};
+}
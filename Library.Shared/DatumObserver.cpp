@@ -0,0 +1,171 @@
+#include "DatumObserver.h"
+
+/// <summary>
+/// Method definitions to support the DatumObserver class.
+/// </summary>
+namespace FieaGameEngine
+{
+	Vector<DatumObserver::PendingChange> DatumObserver::Pending;
+	std::mutex DatumObserver::PendingMutex;
+	std::uint64_t DatumObserver::NextToken = 1;
+
+	std::uint64_t DatumObserver::Observe(Scope& scope, const std::string& key, Callback callback, size_t index)
+	{
+		if (!callback)
+		{
+			throw std::runtime_error("DatumObserver requires a function to call on changes.");
+		}
+		if (scope.Observers == nullptr)
+		{
+			scope.Observers = new DatumObserverList();
+		}
+		const std::uint64_t token = NextToken++;
+		scope.Observers->Observers.PushBack(DatumObserverList::Observer{ token, key, index, std::move(callback) });
+		return token;
+	}
+
+	bool DatumObserver::Unobserve(Scope& scope, std::uint64_t token)
+	{
+		if (scope.Observers == nullptr)
+		{
+			return false;
+		}
+		Vector<DatumObserverList::Observer>& observers = scope.Observers->Observers;
+		for (size_t i = 0; i < observers.Size(); i++)
+		{
+			if (observers[i].Token == token)
+			{
+				//Later observers are moved down one at a time, keeping them in the order they were registered in.
+				for (size_t j = i; j + 1 < observers.Size(); j++)
+				{
+					observers[j] = std::move(observers[j + 1]);
+				}
+				observers.PopBack();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	size_t DatumObserver::Dispatch()
+	{
+		//Taken as a whole first, so that writes made by observers are queued for the next dispatch rather than extending this one.
+		Vector<PendingChange> changes;
+		{
+			std::lock_guard<std::mutex> lock(PendingMutex);
+			changes = std::move(Pending);
+		}
+		for (size_t i = 0; i < changes.Size(); i++)
+		{
+			Scope* scope = ScopeHandleTable::Resolve(changes[i].Target);
+			if (scope != nullptr && scope->Observers != nullptr)
+			{
+				scope->Observers->PendingKeys.Clear();
+			}
+		}
+
+		size_t calls = 0;
+		Vector<std::pair<Callback, size_t>> affected;
+		for (size_t i = 0; i < changes.Size(); i++)
+		{
+			const PendingChange& change = changes[i];
+			Scope* scope = ScopeHandleTable::Resolve(change.Target);
+			if (scope == nullptr || scope->Observers == nullptr)
+			{
+				continue; //Destroyed, or stripped of its observers by a move, since the change was queued.
+			}
+
+			//Matching observers are gathered before any is called, as an observer may register or unregister others.
+			const Datum* current = scope->Find(change.Key);
+			affected.Clear();
+			const Vector<DatumObserverList::Observer>& observers = scope->Observers->Observers;
+			for (size_t j = 0; j < observers.Size(); j++)
+			{
+				if (observers[j].Key == change.Key && Affects(observers[j], current, change.Previous))
+				{
+					affected.PushBack(std::pair(observers[j].Function, observers[j].Index));
+				}
+			}
+			for (size_t j = 0; j < affected.Size(); j++)
+			{
+				affected[j].first(DatumChange{ *scope, change.Key, current, change.Previous, affected[j].second });
+				calls++;
+			}
+		}
+		return calls;
+	}
+
+	size_t DatumObserver::PendingCount()
+	{
+		std::lock_guard<std::mutex> lock(PendingMutex);
+		return Pending.Size();
+	}
+
+	void DatumObserver::DatumChanging(Scope& scope, const std::string& key, const Datum& datum, size_t index)
+	{
+		DatumObserverList& list = *scope.Observers;
+		for (size_t i = 0; i < list.PendingKeys.Size(); i++)
+		{
+			if (list.PendingKeys[i] == key)
+			{
+				return; //Already queued, along with the value from before its first write.
+			}
+		}
+
+		bool observed = false;
+		for (size_t i = 0; i < list.Observers.Size() && !observed; i++)
+		{
+			const DatumObserverList::Observer& observer = list.Observers[i];
+			observed = observer.Key == key && (observer.Index == Scope::EntireDatum || index == Scope::EntireDatum || observer.Index == index);
+		}
+		if (!observed)
+		{
+			return;
+		}
+
+		//Copied into storage of its own, as a prescribed attribute's external storage is about to be overwritten in place. Nested scopes are not copied, so Table datums report every write.
+		Datum previous(datum.Type());
+		previous.AssignElements(datum);
+		list.PendingKeys.PushBack(key);
+		PendingChange change{ ScopeHandleTable::HandleOf(scope), key, std::move(previous) };
+		std::lock_guard<std::mutex> lock(PendingMutex);
+		if (Pending.Size() == Pending.Capacity())
+		{
+			Pending.Reserve(std::max<size_t>(Pending.Capacity() * 2, InitialPending)); //Doubled, so that a frame of many changes does not move the queue once per change.
+		}
+		Pending.PushBack(std::move(change));
+	}
+
+	void DatumObserver::ScopeClearing(Scope& scope)
+	{
+		for (size_t i = 0; i < scope.Observers->Observers.Size(); i++)
+		{
+			const std::string& key = scope.Observers->Observers[i].Key;
+			const Datum* datum = scope.Find(key);
+			if (datum != nullptr)
+			{
+				DatumChanging(scope, key, *datum, Scope::EntireDatum);
+			}
+		}
+	}
+
+	bool DatumObserver::Affects(const DatumObserverList::Observer& observer, const Datum* current, const Datum& previous)
+	{
+		if (current == nullptr)
+		{
+			return observer.Index == Scope::EntireDatum ? previous.Size() > 0 || previous.Type() != Datum::DatumTypes::Unknown : observer.Index < previous.Size();
+		}
+		if (observer.Index == Scope::EntireDatum)
+		{
+			return !current->ElementsEqual(previous);
+		}
+
+		const bool inCurrent = observer.Index < current->Size();
+		const bool inPrevious = observer.Index < previous.Size();
+		if (inCurrent != inPrevious)
+		{
+			return true;
+		}
+		return inCurrent && (current->Type() != previous.Type() || !current->ElementsEqual(previous, observer.Index, 1));
+	}
+}
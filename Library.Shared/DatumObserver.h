@@ -0,0 +1,121 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include "Scope.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A change delivered to an observer. Current is nullptr if the key no longer exists in the scope, such as after the scope was cleared, and Previous holds the value of the whole Datum as it was
+	/// before the first write since the last dispatch. Index is the element the observer was registered on, or Scope::EntireDatum.
+	/// </summary>
+	struct DatumChange final
+	{
+		Scope& Owner;
+		const std::string& Key;
+		const Datum* Current;
+		const Datum& Previous;
+		size_t Index;
+	};
+
+	/// <summary>
+	/// The observers registered on a single scope, along with the keys of that scope that have changes pending. Owned by the scope.
+	/// </summary>
+	struct DatumObserverList final
+	{
+		struct Observer final
+		{
+			std::uint64_t Token;
+			std::string Key;
+			size_t Index;
+			std::function<void(const DatumChange&)> Function;
+		};
+
+		Vector<Observer> Observers;
+		Vector<std::string> PendingKeys;
+	};
+
+	/// <summary>
+	/// The DatumObserver class, which lets game logic be told when an attribute changes rather than polling it each frame. An observer is registered on a key of a scope, and optionally on a single
+	/// element of that key's Datum. Writes through the Datum, such as SetInt, operator= or the mutable getters, queue the change, and Dispatch later calls each observer whose value actually differs from
+	/// its value before the first queued write, so repeated writes between dispatches fire once and writes that restore the previous value do not fire at all. Table datums are
+	/// compared without their nested scopes, so observers of a Table key fire on every queued write. Scopes without observers pay only a null
+	/// pointer test per write.
+	///
+	/// Observers follow the scope's contents when it is moved, as its handle does, and are discarded when the scope is destroyed. Writes made directly to the external storage of a prescribed attribute
+	/// bypass the Datum and are not observed. Queuing changes is synchronized, so the workers of a parallel visit may each write to the scope they were given, but registering observers and dispatching
+	/// must not run on more than one thread at a time, nor alongside writes to observed scopes.
+	/// </summary>
+	class DatumObserver final
+	{
+	public:
+		/// <summary>
+		/// The function called with each change delivered to an observer.
+		/// </summary>
+		using Callback = std::function<void(const DatumChange&)>;
+
+		/// <summary>
+		/// Registers an observer on the provided key of the provided scope. The key need not exist yet. Throws a runtime error if the callback is empty.
+		/// </summary>
+		/// <param name="scope">The scope whose Datum is observed.</param>
+		/// <param name="key">The key of the observed Datum.</param>
+		/// <param name="callback">The function called when the observed value changes.</param>
+		/// <param name="index">The element of the Datum to observe, or Scope::EntireDatum to observe every element as well as its size.</param>
+		/// <returns>A token identifying the observer, used to unregister it.</returns>
+		static std::uint64_t Observe(Scope& scope, const std::string& key, Callback callback, size_t index = Scope::EntireDatum);
+		/// <summary>
+		/// Unregisters the observer with the provided token from the provided scope.
+		/// </summary>
+		/// <param name="scope">The scope the observer was registered on.</param>
+		/// <param name="token">The token returned when the observer was registered.</param>
+		/// <returns>A boolean indicating whether or not the observer was found and removed.</returns>
+		static bool Unobserve(Scope& scope, std::uint64_t token);
+		/// <summary>
+		/// Delivers every queued change to the observers whose values differ from before the change, typically once per frame. Changes made by the observers themselves are queued for the next dispatch.
+		/// </summary>
+		/// <returns>The number of observer calls made.</returns>
+		static size_t Dispatch();
+		/// <summary>
+		/// Returns the number of observed Datums with changes waiting to be dispatched.
+		/// </summary>
+		/// <returns>A size_t indicating the number of pending changes.</returns>
+		[[nodiscard]] static size_t PendingCount();
+
+	private:
+		friend Scope;
+
+		/// <summary>
+		/// A queued change to one key of an observed scope, holding the Datum's value from before the first write.
+		/// </summary>
+		struct PendingChange final
+		{
+			ScopeHandle Target;
+			std::string Key;
+			Datum Previous;
+		};
+
+		/// <summary>
+		/// Called by Scope before a Datum of an observed scope is written, queuing the change if the key is observed and not already queued.
+		/// </summary>
+		static void DatumChanging(Scope& scope, const std::string& key, const Datum& datum, size_t index);
+		/// <summary>
+		/// Called by Scope before an observed scope is cleared, queuing a change for every observed key the scope holds.
+		/// </summary>
+		static void ScopeClearing(Scope& scope);
+		[[nodiscard]] static bool Affects(const DatumObserverList::Observer& observer, const Datum* current, const Datum& previous);
+
+		static Vector<PendingChange> Pending;
+		/// <summary>
+		/// The number of changes reserved for when the first change is queued.
+		/// </summary>
+		static constexpr size_t InitialPending = 64;
+		/// <summary>
+		/// Guards Pending, which is added to from whichever thread writes to an observed scope.
+		/// </summary>
+		static std::mutex PendingMutex;
+		static std::uint64_t NextToken;
+	};
+}
@@ -0,0 +1,370 @@
+#include "FrozenScopeTable.h"
+#include "Scope.h"
+#include "HashFunctor.h"
+
+/// <summary>
+/// Method definitions to support the FrozenScopeTable class.
+/// </summary>
+namespace FieaGameEngine
+{
+	void FrozenScopeTable::Freeze(Scope& root)
+	{
+		if (root.Frozen != nullptr)
+		{
+			return;
+		}
+
+		//First pass: gather every mutable scope in the hierarchy and measure the blocks needed to hold them.
+		Vector<Scope*> nodes;
+		nodes.PushBack(&root);
+		size_t entryCount = 0;
+		size_t childCount = 0;
+		size_t valueBytes = 0;
+		for (size_t i = 0; i < nodes.Size(); i++)
+		{
+			Scope& node = *nodes[i];
+			entryCount += node.OrderTable.Size();
+			for (size_t j = 0; j < node.OrderTable.Size(); j++)
+			{
+				const Datum& datum = node.OrderTable[j]->second;
+				if (datum.Type() == Datum::DatumTypes::Table)
+				{
+					childCount += datum.Size();
+					for (size_t k = 0; k < datum.Size(); k++)
+					{
+						Scope* child = datum.GetConstScope(k);
+						if (child->Frozen == nullptr)
+						{
+							nodes.PushBack(child);
+						}
+					}
+				}
+				else if (!datum.IsExternal && datum.Size() > 0)
+				{
+					valueBytes += AlignedSize(datum.Size() * Datum::TypeSize[static_cast<size_t>(datum.Type())]);
+				}
+			}
+		}
+
+		//Second pass: move every entry into the shared blocks, scope by scope, and build each perfect hash.
+		std::shared_ptr<FrozenScopeTable> table(new FrozenScopeTable());
+		if (entryCount > 0)
+		{
+			table->Entries = static_cast<PairType*>(malloc(entryCount * sizeof(PairType)));
+			assert(table->Entries != nullptr);
+		}
+		if (childCount > 0)
+		{
+			table->Children = static_cast<Scope**>(malloc(childCount * sizeof(Scope*)));
+			assert(table->Children != nullptr);
+		}
+		if (valueBytes > 0)
+		{
+			table->Values = static_cast<std::byte*>(malloc(valueBytes));
+			assert(table->Values != nullptr);
+		}
+		table->ValueCapacity = valueBytes;
+		table->Nodes.Reserve(nodes.Size());
+
+		for (size_t i = 0; i < nodes.Size(); i++)
+		{
+			table->Layout(*nodes[i], i, table);
+		}
+	}
+
+	FrozenScopeTable::~FrozenScopeTable()
+	{
+		for (size_t i = 0; i < EntryCount; i++)
+		{
+			Datum& datum = Entries[i].second;
+			if (datum.Type() == Datum::DatumTypes::String && datum.Data.vp != nullptr && OwnsStorage(datum))
+			{
+				for (size_t j = 0; j < datum.CurrentSize; j++)
+				{
+					datum.Data.s[j].~basic_string();
+				}
+			}
+			datum.Owner = nullptr; //The owning scopes may already be gone by the time the last reference to the table is released.
+			Entries[i].~PairType();
+		}
+		free(Entries);
+		free(Children);
+		free(Values);
+	}
+
+	Datum* FrozenScopeTable::Find(size_t node, const std::string& key) const
+	{
+		const NodeRecord& record = Nodes[node];
+		if (record.EntryCount == 0)
+		{
+			return nullptr;
+		}
+
+		const std::uint64_t keyHash = SeededStringHash{}(key, record.HashSeed);
+		const std::uint32_t displacement = Displacements[record.FirstBucket + static_cast<size_t>(keyHash % record.BucketCount)];
+		const std::uint32_t index = Slots[record.FirstSlot + SlotFor(keyHash, displacement, record.SlotMask)];
+		if (index == EmptySlot)
+		{
+			return nullptr;
+		}
+
+		PairType& entry = Entries[record.FirstEntry + index];
+		return entry.first == key ? &entry.second : nullptr;
+	}
+
+	bool FrozenScopeTable::OwnsStorage(const Datum& datum) const
+	{
+		const std::byte* storage = static_cast<const std::byte*>(datum.Data.vp);
+		if (storage == nullptr)
+		{
+			return false;
+		}
+		const std::byte* values = Values;
+		const std::byte* children = reinterpret_cast<const std::byte*>(Children);
+		return (storage >= values && storage < values + ValueCapacity) || (storage >= children && storage < children + (ChildCount * sizeof(Scope*)));
+	}
+
+	void FrozenScopeTable::Layout(Scope& node, size_t nodeIndex, const std::shared_ptr<FrozenScopeTable>& self)
+	{
+		NodeRecord record;
+		record.FirstEntry = EntryCount;
+		record.EntryCount = node.OrderTable.Size();
+
+		for (size_t i = 0; i < node.OrderTable.Size(); i++)
+		{
+			PairType& source = *node.OrderTable[i];
+			Datum& sourceDatum = source.second;
+			PairType* entry = new(Entries + EntryCount) PairType(source.first, Datum());
+			EntryCount++;
+			Datum& frozenDatum = entry->second;
+
+			if (sourceDatum.Type() == Datum::DatumTypes::Table)
+			{
+				Scope** children = Children + ChildCount;
+				for (size_t j = 0; j < sourceDatum.Size(); j++)
+				{
+					children[j] = sourceDatum.GetConstScope(j); //Read without notifying, as freezing does not change the scope's contents.
+				}
+				ChildCount += sourceDatum.Size();
+				frozenDatum.SetStorage(Datum::DatumTypes::Table, children, sourceDatum.Size());
+			}
+			else if (sourceDatum.IsExternal)
+			{
+				frozenDatum.DeepCopy(sourceDatum); //Storage owned by someone else, such as a prescribed attribute, is referenced as it was.
+			}
+			else if (sourceDatum.Size() > 0)
+			{
+				sourceDatum.Unpack(); //Packed strings are given std::strings of their own, which are then moved into the table.
+				const size_t bytes = sourceDatum.Size() * Datum::TypeSize[static_cast<size_t>(sourceDatum.Type())];
+				std::byte* values = Values + ValueBytes;
+				if (sourceDatum.Type() == Datum::DatumTypes::String)
+				{
+					for (size_t j = 0; j < sourceDatum.Size(); j++)
+					{
+						new(values + (j * sizeof(std::string))) std::string(std::move(sourceDatum.Data.s[j]));
+					}
+				}
+				else
+				{
+					memcpy(values, sourceDatum.Data.vp, bytes);
+				}
+				ValueBytes += AlignedSize(bytes);
+				frozenDatum.SetStorage(sourceDatum.Type(), values, sourceDatum.Size());
+			}
+			else
+			{
+				frozenDatum.SetStorage(sourceDatum.Type(), nullptr, 0); //Empty datums are frozen at a capacity of zero so that nothing may be pushed onto them.
+			}
+			//Laying out the frozen datum and releasing its source below move values without changing them, so neither is journaled.
+			sourceDatum.Owner = nullptr;
+			frozenDatum.Owner = &node;
+		}
+
+		BuildPerfectHash(record);
+		Nodes.PushBack(record);
+
+		//Journaled keys point into the mutable layout, so each is moved onto the matching frozen entry before that layout is released.
+		for (size_t i = 0; i < node.Changes.Size(); i++)
+		{
+			Scope::ChangeRecord& change = node.Changes[i];
+			if (change.Key != nullptr)
+			{
+				Datum* frozenDatum = Find(nodeIndex, *change.Key);
+				assert(frozenDatum != nullptr);
+				change.Key = &Scope::KeyOf(*frozenDatum);
+			}
+		}
+
+		//The mutable layout is released, and the order table now indexes the contiguous entries.
+		node.ScopeData.Clear();
+		node.OrderTable.Clear();
+		node.OrderTable.ShrinkToFit();
+		node.OrderTable.Reserve(record.EntryCount);
+		for (size_t i = 0; i < record.EntryCount; i++)
+		{
+			node.OrderTable.PushBack(Entries + record.FirstEntry + i);
+		}
+		node.Frozen = self;
+		node.FrozenNode = nodeIndex;
+	}
+
+	void FrozenScopeTable::BuildPerfectHash(NodeRecord& record)
+	{
+		record.FirstSlot = Slots.Size();
+		record.FirstBucket = Displacements.Size();
+		if (record.EntryCount == 0)
+		{
+			return;
+		}
+
+		const size_t count = record.EntryCount;
+		size_t minimumSlots = 1;
+		while (minimumSlots < count)
+		{
+			minimumSlots <<= 1;
+		}
+		record.BucketCount = (count + 1) / 2;
+		size_t slotCount = minimumSlots;
+
+		Vector<std::uint64_t> keyHashes;
+		Vector<size_t> bucketStart;
+		Vector<std::uint32_t> bucketMembers;
+		Vector<std::uint32_t> slots;
+		Vector<std::uint32_t> displacements;
+		keyHashes.Reserve(count);
+		bucketStart.Reserve(record.BucketCount + 1);
+		bucketMembers.Reserve(count);
+
+		for (;;)
+		{
+			//Hash every key once, then group the entries of each bucket together.
+			keyHashes.Clear();
+			bucketStart.Clear();
+			bucketMembers.Clear();
+			for (size_t i = 0; i <= record.BucketCount; i++)
+			{
+				bucketStart.PushBack(0);
+			}
+			for (size_t i = 0; i < count; i++)
+			{
+				keyHashes.PushBack(SeededStringHash{}(Entries[record.FirstEntry + i].first, record.HashSeed));
+				bucketStart[static_cast<size_t>(keyHashes[i] % record.BucketCount) + 1]++;
+			}
+			size_t largestBucket = 0;
+			for (size_t i = 0; i < record.BucketCount; i++)
+			{
+				largestBucket = std::max(largestBucket, bucketStart[i + 1]);
+				bucketStart[i + 1] += bucketStart[i];
+			}
+			for (size_t i = 0; i < count; i++)
+			{
+				bucketMembers.PushBack(0);
+			}
+			for (size_t i = 0; i < count; i++)
+			{
+				const size_t bucket = static_cast<size_t>(keyHashes[i] % record.BucketCount);
+				size_t position = bucketStart[bucket];
+				while (bucketMembers[position] != 0)
+				{
+					position++;
+				}
+				bucketMembers[position] = static_cast<std::uint32_t>(i + 1); //Stored off by one so that zero marks an unfilled position.
+			}
+
+			slots.Clear();
+			displacements.Clear();
+			for (size_t i = 0; i < slotCount; i++)
+			{
+				slots.PushBack(EmptySlot);
+			}
+			for (size_t i = 0; i < record.BucketCount; i++)
+			{
+				displacements.PushBack(0);
+			}
+
+			//Place the largest buckets first, searching for a displacement that sends every key of the bucket to a free slot.
+			bool placed = true;
+			const size_t slotMask = slotCount - 1;
+			for (size_t bucketSize = largestBucket; bucketSize > 0 && placed; bucketSize--)
+			{
+				for (size_t bucket = 0; bucket < record.BucketCount && placed; bucket++)
+				{
+					const size_t first = bucketStart[bucket];
+					if (bucketStart[bucket + 1] - first != bucketSize)
+					{
+						continue;
+					}
+
+					placed = false;
+					for (std::uint32_t displacement = 0; displacement < MaxDisplacement && !placed; displacement++)
+					{
+						size_t member = 0;
+						for (; member < bucketSize; member++)
+						{
+							const std::uint32_t entry = bucketMembers[first + member] - 1;
+							const size_t slot = SlotFor(keyHashes[entry], displacement, slotMask);
+							if (slots[slot] != EmptySlot)
+							{
+								break;
+							}
+							slots[slot] = entry;
+						}
+
+						if (member == bucketSize)
+						{
+							displacements[bucket] = displacement;
+							placed = true;
+						}
+						else
+						{
+							for (size_t undo = 0; undo < member; undo++)
+							{
+								slots[SlotFor(keyHashes[bucketMembers[first + undo] - 1], displacement, slotMask)] = EmptySlot;
+							}
+						}
+					}
+				}
+			}
+
+			if (placed)
+			{
+				record.SlotMask = slotMask;
+				break;
+			}
+
+			//Grow the slot table first; if keys still cannot be separated, their full hashes collide and a new seed is needed.
+			if (slotCount < minimumSlots * 8)
+			{
+				slotCount <<= 1;
+			}
+			else
+			{
+				slotCount = minimumSlots;
+				record.HashSeed++;
+			}
+		}
+
+		Slots.Reserve(Slots.Size() + slots.Size());
+		for (size_t i = 0; i < slots.Size(); i++)
+		{
+			Slots.PushBack(slots[i]);
+		}
+		Displacements.Reserve(Displacements.Size() + displacements.Size());
+		for (size_t i = 0; i < displacements.Size(); i++)
+		{
+			Displacements.PushBack(displacements[i]);
+		}
+	}
+
+	size_t FrozenScopeTable::AlignedSize(size_t bytes)
+	{
+		constexpr size_t alignment = alignof(std::max_align_t);
+		return (bytes + alignment - 1) & ~(alignment - 1);
+	}
+
+	size_t FrozenScopeTable::SlotFor(std::uint64_t keyHash, std::uint32_t displacement, size_t slotMask)
+	{
+		//Mixes the displacement into the key hash so that each displacement yields an unrelated slot.
+		return static_cast<size_t>(MixHash(keyHash + ((static_cast<std::uint64_t>(displacement) + 1) * 0x9E3779B97F4A7C15ULL))) & slotMask;
+	}
+}
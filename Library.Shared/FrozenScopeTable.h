@@ -0,0 +1,111 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Datum.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	class Scope;
+
+	/// <summary>
+	/// The FrozenScopeTable class, which holds the read-only layout of a Scope hierarchy once it has been frozen. Every key and Datum of every frozen Scope is stored in one contiguous block, in the order the
+	/// Scopes and their entries were visited, alongside one contiguous array of nested Scope pointers and one arena holding every element value. Lookup by key uses a per-Scope perfect hash, so each Find
+	/// hashes the key once and compares at most one stored key. A single table is shared by the frozen root and all of its descendants, and is released once the last of them is cleared or destroyed.
+	/// </summary>
+	class FrozenScopeTable final
+	{
+	public:
+		using PairType = std::pair<const std::string, Datum>;
+
+		/// <summary>
+		/// Converts the provided Scope and every mutable Scope nested inside of it into the frozen layout. The HashMap and Datum arrays of each converted Scope are released, and its OrderTable is rebuilt to
+		/// point at the contiguous entries. Nested Scopes that are already frozen keep their own table and are referenced as they are.
+		/// </summary>
+		/// <param name="root">The Scope at the top of the hierarchy being frozen.</param>
+		static void Freeze(Scope& root);
+
+		FrozenScopeTable(const FrozenScopeTable&) = delete;
+		FrozenScopeTable(FrozenScopeTable&&) = delete;
+		FrozenScopeTable& operator=(const FrozenScopeTable&) = delete;
+		FrozenScopeTable& operator=(FrozenScopeTable&&) = delete;
+		/// <summary>
+		/// Destructor for the FrozenScopeTable, destroying every stored key, Datum and string value before freeing the contiguous blocks they were stored in.
+		/// </summary>
+		~FrozenScopeTable();
+
+		/// <summary>
+		/// Searches the entries of one frozen Scope for the provided key using that Scope's perfect hash. Returns the associated Datum if found, otherwise nullptr.
+		/// </summary>
+		/// <param name="node">The index of the frozen Scope within the table.</param>
+		/// <param name="key">The key associated with the targeted Datum.</param>
+		/// <returns>A Datum* associated to the targeted element, or nullptr if the key is not present.</returns>
+		[[nodiscard]] Datum* Find(size_t node, const std::string& key) const;
+		/// <summary>
+		/// Indicates whether or not the element storage of the provided Datum lives inside of this table's value arena or child array, as opposed to memory owned by a user of external storage.
+		/// </summary>
+		/// <param name="datum">The Datum whose storage is being tested.</param>
+		/// <returns>A boolean indicating whether or not the Datum's elements are owned by this table.</returns>
+		[[nodiscard]] bool OwnsStorage(const Datum& datum) const;
+
+	private:
+		/// <summary>
+		/// The location of a single frozen Scope's entries and perfect hash within the shared blocks of the table.
+		/// </summary>
+		struct NodeRecord final
+		{
+			size_t FirstEntry{ 0 };
+			size_t EntryCount{ 0 };
+			size_t FirstSlot{ 0 };
+			size_t SlotMask{ 0 };
+			size_t FirstBucket{ 0 };
+			size_t BucketCount{ 0 };
+			std::uint64_t HashSeed{ 0 };
+		};
+
+		FrozenScopeTable() = default;
+
+		void Layout(Scope& node, size_t nodeIndex, const std::shared_ptr<FrozenScopeTable>& self);
+		void BuildPerfectHash(NodeRecord& record);
+		[[nodiscard]] static size_t AlignedSize(size_t bytes);
+		[[nodiscard]] static size_t SlotFor(std::uint64_t keyHash, std::uint32_t displacement, size_t slotMask);
+
+		/// <summary>
+		/// Marks a slot of a perfect hash that does not hold any entry.
+		/// </summary>
+		static constexpr std::uint32_t EmptySlot = UINT32_MAX;
+
+		/// <summary>
+		/// The number of displacements tried for a single bucket before the slot table for a Scope is doubled in size.
+		/// </summary>
+		static constexpr std::uint32_t MaxDisplacement = 4096;
+
+		/// <summary>
+		/// The key and Datum pairs of every frozen Scope, stored contiguously. The entries of a single Scope keep the order in which they were appended.
+		/// </summary>
+		PairType* Entries{ nullptr };
+		size_t EntryCount{ 0 };
+		/// <summary>
+		/// The nested Scope pointers referenced by every frozen Table Datum, stored contiguously. Table Datums use external storage over their portion of this array.
+		/// </summary>
+		Scope** Children{ nullptr };
+		size_t ChildCount{ 0 };
+		/// <summary>
+		/// The element values of every frozen Datum that previously held internal storage. Each Datum uses external storage over its portion of this arena.
+		/// </summary>
+		std::byte* Values{ nullptr };
+		size_t ValueBytes{ 0 };
+		size_t ValueCapacity{ 0 };
+
+		Vector<NodeRecord> Nodes;
+		/// <summary>
+		/// The perfect hash slots of every frozen Scope, each holding the index of an entry relative to the first entry of its Scope.
+		/// </summary>
+		Vector<std::uint32_t> Slots;
+		/// <summary>
+		/// The displacement chosen for each bucket of every frozen Scope's perfect hash.
+		/// </summary>
+		Vector<std::uint32_t> Displacements;
+	};
+}
@@ -1,6 +1,8 @@
 #pragma once
+#include <cstdint>
 #include <cstdio>
 #include <string>
+#include <string_view>
 #include <vector>
 //#include "CppUnitTest.h"
 
@@ -92,4 +94,31 @@ namespace FieaGameEngine
 			return hashValue;
 		}
 	};
+
+	/// <summary>
+	/// Scrambles the bits of a 64-bit value so that small differences in the input spread across the whole result. Used to combine hash values and to derive independent hashes from a single key hash.
+	/// </summary>
+	inline std::uint64_t MixHash(std::uint64_t value)
+	{
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+		return value ^ (value >> 31);
+	}
+
+	/// <summary>
+	/// A seeded 64-bit FNV-1a hash over the characters of a string. Unlike the HashMap functors, changing the seed produces an unrelated hash value, allowing callers to retry with a new seed when two keys collide.
+	/// </summary>
+	struct SeededStringHash final
+	{
+		std::uint64_t operator()(std::string_view key, std::uint64_t seed = 0) const
+		{
+			std::uint64_t hashValue = 14695981039346656037ULL ^ seed;
+			for (const char character : key)
+			{
+				hashValue ^= static_cast<std::uint8_t>(character);
+				hashValue *= 1099511628211ULL;
+			}
+			return hashValue;
+		}
+	};
 }
\ No newline at end of file
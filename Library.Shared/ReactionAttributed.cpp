@@ -23,7 +23,7 @@ namespace FieaGameEngine
 	void ReactionAttributed::Notify(const EventPublisher* eventPublisher)
 	{
 		assert(eventPublisher->Is(Event<EventMessageAttributed>::TypeIdClass()));
-		auto publisher = static_cast<const Event<EventMessageAttributed>*>(eventPublisher)->Message();
+		const auto& publisher = static_cast<const Event<EventMessageAttributed>*>(eventPublisher)->Message();
 		for (size_t i = 0; i < Subtype->size(); i++)
 		{
 			if (publisher.GetSubtype() == Subtype[i])
@@ -38,25 +38,7 @@ namespace FieaGameEngine
 
 	void ReactionAttributed::CopyAuxiliaryAttributes(const EventMessageAttributed& publisher)
 	{
-		auto publisherIndices = publisher.GetAuxiliaryAttributes();
-
-		for (size_t j = publisherIndices.first; j < publisherIndices.second; j++)
-		{
-			auto keyPair = publisher.GetPair(j);
-			if (!IsPrescribedAttribute(keyPair.first))
-			{
-				auto& newAttribute = AppendAuxiliaryAttribute(keyPair.first);
-				newAttribute = keyPair.second;
-			}
-			else //If it is a prescribed attribute, we don't do the append. We just set the value, as long as they are the same datum type.
-			{
-				auto& prescribedAttribute = *Find(keyPair.first);
-				if (prescribedAttribute.Type() == keyPair.second.Type())
-				{
-					prescribedAttribute = keyPair.second;
-				}
-			}
-		}
+		CopyAttributesFrom(publisher.AuxiliaryAttributes()); //Prescribed attributes sharing a key are only set when they hold the same datum type.
 	}
 
 	void ReactionAttributed::Update(const GameTime& currentTime)
@@ -1,5 +1,10 @@
 #include "Scope.h"
 #include "Attributed.h"
+#include "FrozenScopeTable.h"
+#include "HashFunctor.h"
+#include "ScopeRelayout.h"
+#include "AttributeIndex.h"
+#include "DatumObserver.h"
 
 /// <summary>
 /// Method definitions to support the Scope class.
@@ -15,7 +20,14 @@ namespace FieaGameEngine
 
 	Scope::~Scope()
 	{
+		AttributeIndexBase::DetachIndexes(*this);
+		delete Observers;
+		Observers = nullptr;
 		Clear();
+		if (HandleSlot != ScopeHandleTable::NoSlot)
+		{
+			ScopeHandleTable::Release(HandleSlot);
+		}
 	}
 
 	Scope::Scope(const Scope& other)
@@ -24,36 +36,97 @@ namespace FieaGameEngine
 	}
 
 	Scope::Scope(Scope&& movedScope) noexcept
-		: OrderTable(std::move(movedScope.OrderTable))
-		 ,ScopeData(std::move(movedScope.ScopeData))
+		: ScopeData(std::move(movedScope.ScopeData))
+		 ,OrderTable(std::move(movedScope.OrderTable))
+		 ,Frozen(std::move(movedScope.Frozen))
+		 ,FrozenNode(movedScope.FrozenNode)
+		 ,KeyFilter(movedScope.KeyFilter)
+		 ,CachedHash(movedScope.CachedHash)
+		 ,HashValid(movedScope.HashValid.load())
+		 ,HashExact(movedScope.HashExact)
+		 ,Changes(std::move(movedScope.Changes))
+		 ,TrackingChanges(movedScope.TrackingChanges)
+		 ,Dirty(movedScope.Dirty)
+		 ,DescendantDirty(movedScope.DescendantDirty.load())
+		 ,HandleSlot(movedScope.HandleSlot)
 	{
-		if (movedScope.Parent != nullptr)
+		if (HandleSlot != ScopeHandleTable::NoSlot)
 		{
-			movedScope = *movedScope.Orphan();
-			delete(&movedScope);
+			ScopeHandleTable::Retarget(HandleSlot, *this);
+			movedScope.HandleSlot = ScopeHandleTable::NoSlot;
 		}
+		AttributeIndexBase::TransferIndexes(movedScope, *this);
+		Observers = std::exchange(movedScope.Observers, nullptr);
+		TakeOwnershipOfContents();
+		movedScope.ResetMovedFrom();
 	}
 
 	Scope& Scope::operator=(Scope&& movedScope) noexcept
 	{
-		if (movedScope != *this)
+		if (this != &movedScope)
 		{
 			Clear();
-			OrderTable = std::move(movedScope.OrderTable);
 			ScopeData = std::move(movedScope.ScopeData);
-			if (movedScope.Parent != nullptr)
+			OrderTable = std::move(movedScope.OrderTable);
+			Frozen = std::move(movedScope.Frozen);
+			FrozenNode = movedScope.FrozenNode;
+			KeyFilter = movedScope.KeyFilter;
+			//Handles follow the moved contents, so those issued for this scope's previous contents go stale.
+			if (HandleSlot != ScopeHandleTable::NoSlot)
 			{
-				movedScope = *movedScope.Orphan();
-				delete(&movedScope);
+				ScopeHandleTable::Release(HandleSlot);
 			}
-			if (Parent != nullptr)
+			HandleSlot = movedScope.HandleSlot;
+			if (HandleSlot != ScopeHandleTable::NoSlot)
 			{
-				delete(Orphan());
+				ScopeHandleTable::Retarget(HandleSlot, *this);
+				movedScope.HandleSlot = ScopeHandleTable::NoSlot;
 			}
+			AttributeIndexBase::TransferIndexes(movedScope, *this);
+			delete Observers; //Observers follow the moved contents, as handles do.
+			Observers = std::exchange(movedScope.Observers, nullptr);
+			TakeOwnershipOfContents();
+			InvalidateStructuralHash();
+			if (movedScope.DescendantDirty)
+			{
+				DescendantDirty = true;
+				FlagDirtyAncestors(); //Carries changes pending in the moved descendants up to this scope's ancestors.
+			}
+			movedScope.ResetMovedFrom();
 		}
 		return *this;
 	}
 
+	void Scope::TakeOwnershipOfContents()
+	{
+		for (size_t i = 0; i < OrderTable.Size(); i++)
+		{
+			Datum& datum = OrderTable[i]->second;
+			datum.Owner = this;
+			if (datum.Type() == Datum::DatumTypes::Table)
+			{
+				for (size_t j = 0; j < datum.Size(); j++)
+				{
+					datum.GetConstScope(j)->Parent = this;
+				}
+			}
+		}
+	}
+
+	void Scope::ResetMovedFrom()
+	{
+		//The moved scope keeps its place in any hierarchy, now empty, and is given a fresh HashMap since the moved one took its buckets.
+		ScopeData = HashMap<const std::string, Datum>();
+		OrderTable.Clear();
+		FrozenNode = 0;
+		KeyFilter = 0;
+		Changes.Clear();
+		Dirty = false;
+		DescendantDirty = false;
+		InvalidateStructuralHash();
+		RecordChange(ChangeKind::Cleared, nullptr, EntireDatum);
+	}
+
 	Scope& Scope::operator=(const Scope& other)
 	{
 		if (this != &other)
@@ -77,7 +150,11 @@ namespace FieaGameEngine
 
 	bool Scope::operator==(const Scope& comparedScope) const
 	{
-		if (ScopeData.Size() != comparedScope.ScopeData.Size())
+		if (OrderTable.Size() != comparedScope.OrderTable.Size())
+		{
+			return false;
+		}
+		if (CachedHashesDiffer(comparedScope))
 		{
 			return false;
 		}
@@ -86,21 +163,35 @@ namespace FieaGameEngine
 		{
 			i = 1;
 		}
+		//Scopes built or copied alike hold their keys in the same order, so each key is first checked against the same position, and only looked up in an index of this scope's keys otherwise.
+		Vector<const std::pair<const std::string, Datum>*> keyIndex;
 		for (i; i < OrderTable.Size(); i++)
 		{
-			Datum* currentValue = Find(comparedScope.OrderTable[i]->first);
+			const auto& [comparedKey, comparedValue] = *comparedScope.OrderTable[i];
+			const Datum* currentValue = OrderTable[i]->first == comparedKey ? &OrderTable[i]->second : FindIndexed(comparedKey, keyIndex);
 
-			if (currentValue == nullptr || currentValue->Type() != comparedScope.OrderTable[i]->second.Type())
+			if (currentValue == nullptr || currentValue->Type() != comparedValue.Type())
 			{
 				return false;
 			}
 
-			if (currentValue->Type() == Datum::DatumTypes::Table && *(currentValue->GetScope()) != *(comparedScope.OrderTable[i]->second.GetScope()))
+			if (currentValue->Type() == Datum::DatumTypes::Table)
 			{
-				return false;
+				if (currentValue->Size() != comparedValue.Size())
+				{
+					return false;
+				}
+				for (size_t j = 0; j < currentValue->Size(); j++)
+				{
+					if (*(currentValue->GetConstScope(j)) != *(comparedValue.GetConstScope(j)))
+					{
+						return false;
+					}
+				}
 			}
 
-			else if (currentValue->Type() != Datum::DatumTypes::Table && *currentValue != comparedScope.OrderTable[i]->second)
+			//Frozen scopes hold their values in external storage owned by the scope, so ownership is compared rather than the storage mode itself.
+			else if (OwnsStorage(*currentValue) != comparedScope.OwnsStorage(comparedValue) || !currentValue->ElementsEqual(comparedValue))
 			{
 				return false;
 			}
@@ -115,6 +206,20 @@ namespace FieaGameEngine
 
 	Datum* Scope::Find(const std::string& key) const
 	{
+		return FindFiltered(key, KeyFilterMask(key));
+	}
+
+	Datum* Scope::FindFiltered(const std::string& key, std::uint64_t keyMask) const
+	{
+		if ((KeyFilter & keyMask) != keyMask)
+		{
+			return nullptr; //One of the key's bits is unset, so no key of this scope can match it.
+		}
+		if (Frozen != nullptr)
+		{
+			return Frozen->Find(FrozenNode, key);
+		}
+
 		size_t i = 0;
 		for (i = 0; i < OrderTable.Size(); i++)
 		{
@@ -132,33 +237,33 @@ namespace FieaGameEngine
 
 	Datum* Scope::Search(const std::string& key, Scope*& foundScope)
 	{
-		Datum* locatedValue = Find(key);
-		if (locatedValue == nullptr)
+		//The key is hashed once, and each ancestor that cannot hold it is passed over with a single test of its key filter.
+		const std::uint64_t keyMask = KeyFilterMask(key);
+		for (Scope* scope = this; scope != nullptr; scope = scope->Parent)
 		{
-			if (Parent != nullptr)
+			Datum* locatedValue = scope->FindFiltered(key, keyMask);
+			if (locatedValue != nullptr)
 			{
-				return(Parent->Search(key, foundScope));
+				foundScope = scope;
+				return locatedValue;
 			}
-			foundScope = nullptr;
-		}
-		else
-		{
-			foundScope = this;
 		}
-		return locatedValue;
+		foundScope = nullptr;
+		return nullptr;
 	}
 
 	Datum* Scope::Search(const std::string& key) const
 	{
-		Datum* locatedValue = Find(key);
-		if (locatedValue == nullptr)
+		const std::uint64_t keyMask = KeyFilterMask(key);
+		for (const Scope* scope = this; scope != nullptr; scope = scope->Parent)
 		{
-			if (Parent != nullptr)
+			Datum* locatedValue = scope->FindFiltered(key, keyMask);
+			if (locatedValue != nullptr)
 			{
-				return(Parent->Search(key));
+				return locatedValue;
 			}
 		}
-		return locatedValue;
+		return nullptr;
 	}
 
 	Datum& Scope::At(size_t index) const //This returns the targeted scope.
@@ -168,10 +273,24 @@ namespace FieaGameEngine
 
 	Datum& Scope::Append(const std::string& datumName)
 	{
+		if (Frozen != nullptr)
+		{
+			Datum* existingDatum = Frozen->Find(FrozenNode, datumName);
+			if (existingDatum == nullptr)
+			{
+				throw std::runtime_error("Cannot append new keys to a frozen Scope!");
+			}
+			return *existingDatum;
+		}
+
 		auto result = ScopeData.Insert(std::pair(datumName, Datum()));
 		if (result.second)
 		{
 			OrderTable.PushBack(&(*result.first));
+			KeyFilter |= KeyFilterMask(datumName);
+			(*result.first).second.Owner = this;
+			InvalidateStructuralHash();
+			RecordChange(ChangeKind::Appended, &(*result.first).first, EntireDatum);
 		}
 		return (*result.first).second;
 	}
@@ -203,6 +322,10 @@ namespace FieaGameEngine
 		{ 
 			return;
 		}
+		if (Frozen != nullptr)
+		{
+			throw std::runtime_error("Cannot adopt into a frozen Scope!");
+		}
 		if (IsDescendantOf(*child) || this == child)
 		{
 			throw std::runtime_error("Cannot adopt an acestor or yourself!");
@@ -213,18 +336,44 @@ namespace FieaGameEngine
 			throw std::runtime_error("The specified ley already exists but is not of type Scope."); 
 		}
 		// All validation is complete and we should be guaranteed that this operation will succeed.
-		child->Orphan();
+		child->Detach(); //A relocated child stays where it is, since ownership passes directly to this scope.
 		child->Parent = this;
 		datum.PushBack(child);
+		RecordChange(ChangeKind::Adopted, &KeyOf(datum), datum.Size() - 1);
+		if (child->Dirty || child->DescendantDirty)
+		{
+			child->FlagDirtyAncestors(); //Carries the child's pending changes up to its new ancestors.
+		}
+		if (AttributeIndexBase::AnyIndexes())
+		{
+			AttributeIndexBase::ScopeAdopted(*child);
+		}
 	}
 
 	Scope* Scope::Orphan()
+	{
+		Scope* orphan = Detach();
+		if (orphan != nullptr && Arena != nullptr)
+		{
+			//The caller takes ownership and will delete the orphan, so a scope living in a relocated block is moved back into an allocation of its own.
+			orphan = ScopeRelayout::MoveToHeap(*this);
+			DestroyNested(this);
+		}
+		return orphan;
+	}
+
+	Scope* Scope::Detach()
 	{
 		if (Parent != nullptr)
 		{
+			if (Parent->Frozen != nullptr)
+			{
+				throw std::runtime_error("Cannot orphan a Scope from a frozen parent!");
+			}
 			auto [datum, datumIndex] = Parent->FindContainedScope(this); //We find the object containing it to orphan the scope.
 			assert(datum != nullptr);
 			datum->RemoveAt(datumIndex);
+			Parent->RecordChange(ChangeKind::Orphaned, &KeyOf(*datum), datumIndex);
 			Parent = nullptr;
 			return this;
 		}
@@ -236,6 +385,11 @@ namespace FieaGameEngine
 		return Parent;
 	}
 
+	ScopeHandle Scope::Handle()
+	{
+		return ScopeHandleTable::HandleOf(*this);
+	}
+
 	std::pair<Datum*, size_t> Scope::FindContainedScope(const Scope* targetScope) const
 	{
 		std::pair<Datum*, size_t> newPair(nullptr, 0);
@@ -245,7 +399,7 @@ namespace FieaGameEngine
 			{
 				for (size_t j = 0; j < OrderTable[i]->second.Size(); j++)
 				{
-					if (OrderTable[i]->second.GetScope(j) == targetScope)
+					if (OrderTable[i]->second.GetConstScope(j) == targetScope)
 					{
 						newPair.first = &OrderTable[i]->second;
 						newPair.second = j;
@@ -273,11 +427,15 @@ namespace FieaGameEngine
 				newDatum.Reserve(existingDatum.Size());
 				for (size_t j = 0; j < existingDatum.Size(); ++j)
 				{
-					Scope* nestedScope = existingDatum.GetScope(j)->Clone();
+					Scope* nestedScope = existingDatum.GetConstScope(j)->Clone();
 					nestedScope->Parent = this;
 					newDatum.PushBack(nestedScope);
 				}
 			}
+			else if (other.Frozen != nullptr && other.Frozen->OwnsStorage(existingDatum))
+			{
+				newDatum.CopyElements(existingDatum); //Values owned by a frozen table are copied so that the new scope does not depend on it.
+			}
 			else
 			{
 				newDatum = existingDatum;
@@ -287,6 +445,10 @@ namespace FieaGameEngine
 
 	void Scope::Clear()
 	{
+		if (Observers != nullptr)
+		{
+			DatumObserver::ScopeClearing(*this);
+		}
 
 		for (size_t i=0; i < OrderTable.Size(); i++)
 		{
@@ -296,12 +458,22 @@ namespace FieaGameEngine
 			{
 				for (size_t j = 0; j < datum.Size(); j++)
 				{
-					delete& datum[j];
+					DestroyNested(datum.GetConstScope(j));
 				}
 			}
 		}
 		OrderTable.Clear();
 		ScopeData.Clear();
+		Frozen.reset();
+		FrozenNode = 0;
+		KeyFilter = 0;
+		InvalidateStructuralHash();
+		Changes.Clear(); //Recorded keys no longer exist, so the journal is replaced with a single record of the clear.
+		RecordChange(ChangeKind::Cleared, nullptr, EntireDatum);
+		if (AttributeIndexBase::AnyIndexes())
+		{
+			AttributeIndexBase::ScopeChanged(*this, nullptr);
+		}
 	}
 
 	size_t Scope::Size() const
@@ -309,12 +481,265 @@ namespace FieaGameEngine
 		return OrderTable.Size();
 	}
 
+	void Scope::Freeze()
+	{
+		FrozenScopeTable::Freeze(*this);
+	}
+
+	bool Scope::IsFrozen() const
+	{
+		return Frozen != nullptr;
+	}
+
+	std::uint64_t Scope::StructuralHash() const
+	{
+		if (!HashValid)
+		{
+			//Entry hashes are summed so that the result does not depend on the order keys were appended in.
+			std::uint64_t hash = MixHash(OrderTable.Size());
+			bool exact = true;
+			for (size_t i = 0; i < OrderTable.Size(); i++)
+			{
+				const auto& [key, datum] = *OrderTable[i];
+				std::uint64_t datumHash;
+				if (datum.ElementsEscaped)
+				{
+					datumHash = MixHash((static_cast<std::uint64_t>(datum.Type()) << 32) ^ datum.Size() ^ (1ULL << 62));
+					exact = false;
+				}
+				else if (datum.Type() == Datum::DatumTypes::Table || OwnsStorage(datum))
+				{
+					datumHash = datum.Hash();
+					for (size_t j = 0; j < datum.Size() && datum.Type() == Datum::DatumTypes::Table; j++)
+					{
+						exact = exact && datum.GetConstScope(j)->HashExact; //Already computed by hashing the Datum.
+					}
+				}
+				else
+				{
+					datumHash = MixHash((static_cast<std::uint64_t>(datum.Type()) << 32) ^ datum.Size() ^ (1ULL << 63));
+				}
+				hash += MixHash(SeededStringHash{}(key) ^ datumHash);
+			}
+			CachedHash = hash;
+			HashExact = exact;
+			HashValid = true;
+		}
+		return CachedHash;
+	}
+
+	bool Scope::MayEqual(const Scope& comparedScope) const
+	{
+		if (OrderTable.Size() != comparedScope.OrderTable.Size())
+		{
+			return false;
+		}
+		StructuralHash();
+		comparedScope.StructuralHash();
+		return !CachedHashesDiffer(comparedScope);
+	}
+
+	bool Scope::CachedHashesDiffer(const Scope& comparedScope) const
+	{
+		//Equality skips an Attributed scope's "this" entry, so equal scopes may differ in that key, which the hash does not allow for.
+		if (comparedScope.Is(Attributed::TypeIdClass()) && !Is(Attributed::TypeIdClass()))
+		{
+			return false;
+		}
+		//HashValid is loaded before HashExact and CachedHash, which are written before it is set.
+		return HashValid && comparedScope.HashValid && HashExact && comparedScope.HashExact && CachedHash != comparedScope.CachedHash;
+	}
+
+	const Datum* Scope::FindIndexed(const std::string& key, Vector<const std::pair<const std::string, Datum>*>& keyIndex) const
+	{
+		if (Frozen != nullptr)
+		{
+			return Frozen->Find(FrozenNode, key);
+		}
+
+		//The index is open addressed with linear probing, and kept at most half full so that probes stay short.
+		size_t slotCount = 1;
+		while (slotCount < 2 * OrderTable.Size())
+		{
+			slotCount <<= 1;
+		}
+		const size_t slotMask = slotCount - 1;
+		if (keyIndex.IsEmpty())
+		{
+			keyIndex.Reserve(slotCount);
+			for (size_t slot = 0; slot < slotCount; slot++)
+			{
+				keyIndex.PushBack(nullptr);
+			}
+			for (size_t i = 0; i < OrderTable.Size(); i++)
+			{
+				size_t slot = static_cast<size_t>(SeededStringHash{}(OrderTable[i]->first)) & slotMask;
+				while (keyIndex[slot] != nullptr)
+				{
+					slot = (slot + 1) & slotMask;
+				}
+				keyIndex[slot] = OrderTable[i];
+			}
+		}
+
+		for (size_t slot = static_cast<size_t>(SeededStringHash{}(key)) & slotMask; keyIndex[slot] != nullptr; slot = (slot + 1) & slotMask)
+		{
+			if (keyIndex[slot]->first == key)
+			{
+				return &keyIndex[slot]->second;
+			}
+		}
+		return nullptr;
+	}
+
+	void Scope::TrackChanges(bool enabled)
+	{
+		TrackingChanges = enabled;
+	}
+
+	bool Scope::IsTrackingChanges() const
+	{
+		return TrackingChanges;
+	}
+
+	bool Scope::IsDirty() const
+	{
+		return Dirty;
+	}
+
+	bool Scope::HasDirtyDescendants() const
+	{
+		return DescendantDirty;
+	}
+
+	const Vector<Scope::ChangeRecord>& Scope::GetChanges() const
+	{
+		return Changes;
+	}
+
+	void Scope::ClearChanges()
+	{
+		if (DescendantDirty)
+		{
+			for (size_t i = 0; i < OrderTable.Size(); i++)
+			{
+				const Datum& datum = OrderTable[i]->second;
+				if (datum.Type() == Datum::DatumTypes::Table)
+				{
+					for (size_t j = 0; j < datum.Size(); j++)
+					{
+						Scope* child = datum.GetConstScope(j);
+						if (child->Dirty || child->DescendantDirty)
+						{
+							child->ClearChanges();
+						}
+					}
+				}
+			}
+		}
+		Changes.Clear();
+		Dirty = false;
+		DescendantDirty = false;
+	}
+
+	void Scope::DatumChanged(const Datum& datum, size_t index)
+	{
+		if (Observers != nullptr)
+		{
+			DatumObserver::DatumChanging(*this, KeyOf(datum), datum, index);
+		}
+		InvalidateStructuralHash();
+		if (TrackingChanges)
+		{
+			RecordChange(ChangeKind::Modified, &KeyOf(datum), index);
+		}
+		if (AttributeIndexBase::AnyIndexes())
+		{
+			AttributeIndexBase::ScopeChanged(*this, &KeyOf(datum));
+		}
+	}
+
+	void Scope::RecordChange(ChangeKind kind, const std::string* key, size_t index)
+	{
+		if (!TrackingChanges)
+		{
+			return;
+		}
+		Dirty = true;
+		FlagDirtyAncestors();
+
+		if (!Changes.IsEmpty() && Changes.Back().Key == key && Changes.Back().Index == index)
+		{
+			if (kind != ChangeKind::Modified)
+			{
+				Changes.Back().Kind = kind; //A structural change supersedes the element write that carried it out.
+			}
+			return;
+		}
+		Changes.PushBack(ChangeRecord{ kind, key, index });
+	}
+
+	void Scope::FlagDirtyAncestors()
+	{
+		Scope* scope = Parent;
+		while (scope != nullptr && !scope->DescendantDirty.exchange(true))
+		{
+			scope = scope->Parent;
+		}
+	}
+
+	std::uint64_t Scope::KeyFilterMask(const std::string& key)
+	{
+		const std::uint64_t keyHash = MixHash(SeededStringHash{}(key));
+		return (1ULL << (keyHash & 63)) | (1ULL << ((keyHash >> 6) & 63));
+	}
+
+	const std::string& Scope::KeyOf(const Datum& datum)
+	{
+		//Every Datum held by a scope is the second member of a key and Datum pair, so the key sits at a fixed distance before it.
+		static const std::ptrdiff_t datumOffset = []()
+		{
+			const std::pair<const std::string, Datum> probe;
+			return reinterpret_cast<const std::byte*>(&probe.second) - reinterpret_cast<const std::byte*>(&probe);
+		}();
+		return reinterpret_cast<const std::pair<const std::string, Datum>*>(reinterpret_cast<const std::byte*>(&datum) - datumOffset)->first;
+	}
+
+	void Scope::DestroyNested(Scope* scope)
+	{
+		if (scope->Arena != nullptr)
+		{
+			//Held until the destructor has finished, since the scope being destroyed may hold the last reference to the block it lives in.
+			std::shared_ptr<void> arena = std::move(scope->Arena);
+			scope->~Scope();
+		}
+		else
+		{
+			delete scope;
+		}
+	}
+
+	void Scope::InvalidateStructuralHash()
+	{
+		//A relaxed load first keeps repeated writes to a scope whose hash is already stale from taking the cache line exclusively.
+		Scope* scope = this;
+		while (scope != nullptr && scope->HashValid.load(std::memory_order_relaxed) && scope->HashValid.exchange(false))
+		{
+			scope = scope->Parent;
+		}
+	}
+
+	bool Scope::OwnsStorage(const Datum& datum) const
+	{
+		return !datum.IsExternal || (Frozen != nullptr && Frozen->OwnsStorage(datum));
+	}
+
 	Scope* Scope::Clone() const
 	{
 		return new Scope(*this);
 	}
 
-	const std::pair<std::string, const Datum> Scope::GetPair(size_t index) const
+	const std::pair<const std::string, Datum>& Scope::GetPair(size_t index) const
 	{
 		return (*OrderTable[index]);
 	}
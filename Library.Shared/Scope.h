@@ -1,14 +1,25 @@
 #pragma once
 #include "HashMap.h"
 #include "Datum.h"
+#include "ScopeHandle.h"
 #include <gsl/gsl>
 #include <cassert>
 #include <algorithm>
 #include <memory>
+#include <atomic>
 #include "Factory.h"
 
 namespace FieaGameEngine
 {
+	class FrozenScopeTable;
+	class ScopeRelayout;
+	class ScopePath;
+	class ScopePublisher;
+	class AttributeIndexBase;
+	class DatumObserver;
+	class ScopeVisitor;
+	struct DatumObserverList;
+
 	/// <summary>
 	/// The scope class, which is also an RTTI pointer, used to manage tables and nested tables of Datum elements, each associated to a string value as in a HashMap. It manages a hierarchy of both the nest structure of
 	/// the storage unit and the order in which elements were added. Allows the user to append new datum, append new scope, access each scope and contained members, and reparent existing scopes. Composed of a Vector
@@ -19,7 +30,44 @@ namespace FieaGameEngine
 		RTTI_DECLARATIONS(Scope, RTTI);
 
 	public:
+		/// <summary>
+		/// The kinds of changes recorded in a scope's change journal.
+		/// </summary>
+		enum class ChangeKind
+		{
+			Modified,
+			Appended,
+			Adopted,
+			Orphaned,
+			Cleared
+		};
+
+		/// <summary>
+		/// A single entry of a scope's change journal. Key points at the key stored by the scope, and remains valid until the scope is cleared; freezing the scope moves it onto the frozen entry. Index is the element of the Datum that changed,
+		/// or EntireDatum when the Datum may have changed as a whole. Cleared records carry no key.
+		/// </summary>
+		struct ChangeRecord final
+		{
+			ChangeKind Kind;
+			const std::string* Key;
+			size_t Index;
+		};
+
+		/// <summary>
+		/// The index recorded when a change affects an entire Datum rather than a single element.
+		/// </summary>
+		static constexpr size_t EntireDatum = SIZE_MAX;
+
 		friend Attributed;
+		friend Datum;
+		friend FrozenScopeTable;
+		friend ScopeRelayout;
+		friend ScopePath;
+		friend ScopeHandleTable;
+		friend ScopePublisher;
+		friend AttributeIndexBase;
+		friend DatumObserver;
+		friend ScopeVisitor;
 
 		friend Factory<Scope>;
 		//template <typename T>
@@ -40,7 +88,8 @@ namespace FieaGameEngine
 		/// <param name="copiedScope">The Scope being deep copied into the newly constructed Scope.</param>
 		Scope(const Scope& copiedScope);
 		/// <summary>
-		/// Move constructor for the Scope data object. Creates a shallow copy of the scope argument given within the new created Scope object. The Scope argument provided will be unusable after the assignment takes place.
+		/// Move constructor for the Scope data object. Creates a shallow copy of the scope argument given within the new created Scope object, reparenting every nested scope to the new Scope. The new Scope
+		/// is a root; the Scope argument keeps its place in any hierarchy it belongs to, but is left empty.
 		/// </summary>
 		/// <param name="movedScope">The Scope to be shallow copied into the newly constructed one.</param>
 		Scope(Scope&& movedScope) noexcept;
@@ -52,7 +101,12 @@ namespace FieaGameEngine
 		/// <param name="copiedScope">The scope to be deep copied into the left hand side.</param>
 		/// <returns>A reference to the newly copied Scope value.</returns>
 		Scope& operator=(const Scope& copiedScope);
-
+		/// <summary>
+		/// Move assignment operator for the Scope data object. Clears the left hand Scope, then takes the contents of the scope argument, reparenting every nested scope to it. Both Scopes keep their places
+		/// in any hierarchy they belong to, and the Scope argument is left empty.
+		/// </summary>
+		/// <param name="movedScope">The scope to be shallow copied into the left hand side.</param>
+		/// <returns>A reference to the Scope that was moved into.</returns>
 		Scope& operator=(Scope&& movedScope) noexcept;
 		/// <summary>
 		/// A bracket operator override for the Scope class. When a valid string key existing within the calling Scope is provided, a reference to the associated Datum object is returned.
@@ -69,7 +123,8 @@ namespace FieaGameEngine
 		Datum& operator[](size_t datumIndex);
 		/// <summary>
 		/// The equality comparison operator for Scope. Compares every element, ignoring parent hierarchy, by key and associated value. Supports comparison for all Datum types and returns a boolean indicating whether or not
-		/// the two Scopes are equal.
+		/// the two Scopes are equal. Scopes whose structural hashes are already cached, and exact, are rejected at once if the hashes differ, without comparing any elements. Keys are matched by position
+		/// where the two scopes share an order, and through an index of the calling scope's keys otherwise, so the comparison takes time linear in the number of keys.
 		/// </summary>
 		/// <param name="comparedScope">The right hand scope being compared to the calling scope.</param>
 		/// <returns>A boolean indicating whether or not the two Scopes are equal.</returns>
@@ -84,7 +139,7 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// Searches within the calling datum (no higher or lower in hierarchy) to find a Datum value associated with the provided key. A Datum* corresponding to the located element is returned
-		/// if found, otherwise returning nullptr.
+		/// if found, otherwise returning nullptr. Keys that cannot be present, according to the scope's key filter, are rejected without comparing any strings.
 		/// </summary>
 		/// <param name="key">The key associated with the targeted Datum.</param>
 		/// <returns>A Datum* associated to the targeted element</returns>
@@ -99,7 +154,7 @@ namespace FieaGameEngine
 		[[nodiscard]] Datum* Search(const std::string& key, Scope*& foundScope);
 		/// <summary>
 		/// Searches within the calling datum and its ancestors to find a target value. Takes one argument: being the key to the target Datum. The address of the target datum is returned
-		/// on completion if found, otherwise returning nullptr.
+		/// on completion if found, otherwise returning nullptr. The key is hashed once, and ancestors whose key filter rules it out are skipped without a lookup.
 		/// </summary>
 		/// <param name="key">The key associated with the target datum.</param>
 		/// <returns>The datum pointer variable, if found, otherwise nullptr.</returns>
@@ -129,7 +184,8 @@ namespace FieaGameEngine
 		void Adopt(Scope* child, const std::string& childKey);
 		/// <summary>
 		/// A function that, when called by a nested scope, derives from it a new root scope while breaking its existing parental and upper hierarchical connections. Its memory must be deleted
-		/// by the caller upon its execution, or there is a risk of memory leaks.
+		/// by the caller upon its execution, or there is a risk of memory leaks. A scope that was relocated by ScopeRelayout is moved into an allocation of its own first, so the returned pointer may differ
+		/// from the calling scope, which must not be used afterwards.
 		/// </summary>
 		/// <returns>A gsl::owner to the Scope* that is newly orphaned.</returns>
 		gsl::owner<Scope*> Orphan(); //Return GSL owner to scope*
@@ -138,6 +194,12 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <returns>A scope* associated to the parent of the calling scope.</returns>
 		Scope* GetParent() const; //returns address of scope that owns this one
+		/// <summary>
+		/// Returns a generational handle to the calling scope, which may be stored in place of a pointer, such as in a Handle Datum. The handle follows the scope's contents when it is moved, including
+		/// when relocated by ScopeRelayout or orphaned out of a relocated block, and resolves to nullptr once the scope is destroyed. A copy of the scope is given a handle of its own.
+		/// </summary>
+		/// <returns>A ScopeHandle referring to the calling scope.</returns>
+		[[nodiscard]] ScopeHandle Handle();
 
 		/// <summary>
 		/// Scans through the upper hierarchy of Scopes to determine whether the calling scope is descended from the Scope argument, that is, if the caller is nested inside of the argument.
@@ -179,7 +241,75 @@ namespace FieaGameEngine
 
 		void DeepCopy(const Scope& other);
 
-		const std::pair<std::string, const Datum> GetPair(size_t index) const;
+		/// <summary>
+		/// Returns a reference to the key and Datum pair added at the chronological index provided, without copying either.
+		/// </summary>
+		/// <param name="index">The chronological order in which the target pair was added.</param>
+		/// <returns>A const reference to the key and Datum pair at the provided index.</returns>
+		[[nodiscard]] const std::pair<const std::string, Datum>& GetPair(size_t index) const;
+
+		/// <summary>
+		/// Converts the calling scope and every scope nested inside of it into a read-only layout, intended for data that no longer changes once loaded. Keys, datums and nested scope pointers of the whole
+		/// hierarchy are moved into shared contiguous blocks, and lookup by key uses a perfect hash instead of the HashMap. Find, Search, At and the Datum getters and setters continue to work, but the
+		/// structure is fixed: new keys may not be appended, datums may not grow or shrink, and scopes may not be adopted into or orphaned from a frozen scope. Copies and clones of a frozen scope are
+		/// mutable, and clearing a frozen scope returns it to the mutable layout. Freezing a scope that is already frozen does nothing.
+		/// </summary>
+		void Freeze();
+		/// <summary>
+		/// Returns a boolean indicating whether or not the calling scope has been frozen, either directly or as part of a frozen ancestor.
+		/// </summary>
+		/// <returns>A boolean indicating whether or not the calling scope is frozen.</returns>
+		[[nodiscard]] bool IsFrozen() const;
+
+		/// <summary>
+		/// Returns a hash of the calling scope's keys, Datum types and values, including every nested scope. The hash does not depend on the order in which keys were appended. Values that may be written
+		/// without the scope's knowledge contribute only their type and size: those stored externally, such as prescribed attributes, and those of any Datum that has handed out a mutable reference or
+		/// span into its elements. The hash is exact when no Datum of the scope or of any nested scope has done the latter, in which case scopes that compare equal always share the same hash, and
+		/// differing hashes prove two scopes are not equal. The hash is cached and recomputed only after the scope or one of its descendants changes, allowing unchanged subtrees to be skipped when
+		/// diffing. Not safe to call concurrently with modifications of the scope or with other calls on the same hierarchy.
+		/// </summary>
+		/// <returns>A 64-bit structural hash of the calling scope.</returns>
+		[[nodiscard]] std::uint64_t StructuralHash() const;
+		/// <summary>
+		/// Returns false if the structural hashes of the calling and provided scopes prove that they are not equal, and true if they may be equal, without comparing any elements. Hashes that are
+		/// not exact prove nothing, so scopes whose Datums have handed out mutable references or spans are always reported as possibly equal.
+		/// </summary>
+		/// <param name="comparedScope">The scope being compared to the calling scope.</param>
+		/// <returns>A boolean indicating whether or not the two scopes may be equal.</returns>
+		[[nodiscard]] bool MayEqual(const Scope& comparedScope) const;
+
+		/// <summary>
+		/// Enables or disables change tracking for the calling scope. While enabled, writes through the scope's Datum setters and mutable getters, as well as Append, Adopt, Orphan and Clear, set the
+		/// scope's dirty bit and are recorded in its change journal, and every ancestor is flagged as having a dirty descendant. Writes made directly to external storage are not observed. Getters that
+		/// return mutable references are journaled whether or not they are written through, so the journal may report conservatively. Disabling tracking does not discard changes already recorded.
+		/// </summary>
+		/// <param name="enabled">Whether or not changes to the calling scope should be tracked.</param>
+		void TrackChanges(bool enabled = true);
+		/// <summary>
+		/// Returns a boolean indicating whether or not change tracking is enabled for the calling scope.
+		/// </summary>
+		/// <returns>A boolean indicating whether or not changes are being tracked.</returns>
+		[[nodiscard]] bool IsTrackingChanges() const;
+		/// <summary>
+		/// Returns a boolean indicating whether or not a tracked change has been made to the calling scope since changes were last cleared.
+		/// </summary>
+		/// <returns>A boolean indicating whether or not the calling scope is dirty.</returns>
+		[[nodiscard]] bool IsDirty() const;
+		/// <summary>
+		/// Returns a boolean indicating whether or not a scope nested inside the calling scope may have been made dirty since changes were last cleared. Consumers can skip subtrees where this and IsDirty
+		/// both return false.
+		/// </summary>
+		/// <returns>A boolean indicating whether or not a descendant of the calling scope may be dirty.</returns>
+		[[nodiscard]] bool HasDirtyDescendants() const;
+		/// <summary>
+		/// Returns the change journal of the calling scope, in the order changes were made. Repeated changes to the same key and index are recorded once.
+		/// </summary>
+		/// <returns>A reference to the calling scope's change journal.</returns>
+		[[nodiscard]] const Vector<ChangeRecord>& GetChanges() const;
+		/// <summary>
+		/// Clears the dirty bits and change journals of the calling scope and every dirty scope nested inside of it, typically once per frame after consumers have processed the changes.
+		/// </summary>
+		void ClearChanges();
 
 	protected:
 		/// <summary>
@@ -196,6 +326,136 @@ namespace FieaGameEngine
 		/// A pointer to the scope that contains the current scope, if it is not a root scope. If it is a root, the value is defaulted to nullptr, and is reset similarly when orphan is called.
 		/// </summary>
 		Scope* Parent{ nullptr };
+		/// <summary>
+		/// The read-only layout shared by every scope of a frozen hierarchy, or nullptr if the scope is mutable. When set, ScopeData is empty and OrderTable points at entries owned by the table.
+		/// </summary>
+		std::shared_ptr<FrozenScopeTable> Frozen;
+		/// <summary>
+		/// The index of the calling scope within its frozen table. Only meaningful while the scope is frozen.
+		/// </summary>
+		size_t FrozenNode{ 0 };
+
+	private:
+		/// <summary>
+		/// Searches the calling scope alone for the provided key, given the key's filter mask, returning nullptr without a lookup if the scope's key filter rules the key out.
+		/// </summary>
+		[[nodiscard]] Datum* FindFiltered(const std::string& key, std::uint64_t keyMask) const;
+		/// <summary>
+		/// Returns the bits a key sets in a scope's key filter.
+		/// </summary>
+		[[nodiscard]] static std::uint64_t KeyFilterMask(const std::string& key);
+		/// <summary>
+		/// Removes the calling scope from its parent, if any, without moving it, returning the calling scope or nullptr if it had no parent.
+		/// </summary>
+		Scope* Detach();
+		/// <summary>
+		/// Points the Owner of every Datum, and the Parent of every nested scope, at the calling scope after its contents were moved into it.
+		/// </summary>
+		void TakeOwnershipOfContents();
+		/// <summary>
+		/// Leaves the calling scope empty and usable after its contents were moved into another scope.
+		/// </summary>
+		void ResetMovedFrom();
+		/// <summary>
+		/// Destroys a nested scope, freeing it if it was allocated on its own, or destroying it in place if it lives in a block shared with other relocated scopes.
+		/// </summary>
+		static void DestroyNested(Scope* scope);
+		/// <summary>
+		/// Called by a Datum held by the calling scope whenever it may have been modified. Queues the change for observers, if the scope has any, then invalidates the structural hash and, if tracking
+		/// is enabled, records the change.
+		/// </summary>
+		/// <param name="datum">The Datum that may have been modified.</param>
+		/// <param name="index">The index of the element that may have changed, or EntireDatum.</param>
+		void DatumChanged(const Datum& datum, size_t index);
+		/// <summary>
+		/// Sets the dirty bit of the calling scope, flags its ancestors, and journals the change, if tracking is enabled. Consecutive changes to the same key and index are merged into one record.
+		/// </summary>
+		void RecordChange(ChangeKind kind, const std::string* key, size_t index);
+		/// <summary>
+		/// Flags every ancestor of the calling scope as having a dirty descendant, stopping at the first ancestor already flagged.
+		/// </summary>
+		void FlagDirtyAncestors();
+		/// <summary>
+		/// Returns the key stored alongside a Datum held by a scope, found from the Datum's position within its key and Datum pair.
+		/// </summary>
+		[[nodiscard]] static const std::string& KeyOf(const Datum& datum);
+		/// <summary>
+		/// Marks the cached structural hash of the calling scope and each of its ancestors as stale. Stops at the first scope that is already stale, as its ancestors must be stale as well.
+		/// </summary>
+		void InvalidateStructuralHash();
+		/// <summary>
+		/// Indicates whether the cached structural hashes of the calling and provided scopes prove that the two are not equal, which requires both hashes to be valid and exact. Computes no hashes,
+		/// so that it stays safe to call from several readers of the same hierarchy at once.
+		/// </summary>
+		/// <param name="comparedScope">The scope being compared to the calling scope.</param>
+		/// <returns>A boolean indicating whether or not the cached hashes prove the two scopes unequal.</returns>
+		[[nodiscard]] bool CachedHashesDiffer(const Scope& comparedScope) const;
+		/// <summary>
+		/// Finds the Datum at the provided key in constant time, through the scope's frozen table or else through the provided index of its keys, which is built on first use if empty. Used when many
+		/// keys are looked up at once, as by the equality operator.
+		/// </summary>
+		/// <param name="key">The key associated with the targeted Datum.</param>
+		/// <param name="keyIndex">An index of the scope's keys, built by the first call that is given an empty one and reused by later calls.</param>
+		/// <returns>The Datum at the provided key, or nullptr if there is none.</returns>
+		[[nodiscard]] const Datum* FindIndexed(const std::string& key, Vector<const std::pair<const std::string, Datum>*>& keyIndex) const;
+		/// <summary>
+		/// Indicates whether the provided Datum of the calling scope stores its elements in memory owned by the scope, either internally or within a frozen table, rather than in external storage.
+		/// </summary>
+		[[nodiscard]] bool OwnsStorage(const Datum& datum) const;
+
+		/// <summary>
+		/// A 64-bit Bloom filter of the scope's keys, in which every appended key sets the two bits given by its hash. A key whose bits are not all set is known to be absent, so most failed lookups,
+		/// and most levels of a Search, cost a single bit test. Keys are never removed from a scope without clearing it, so the filter only needs to be reset by Clear.
+		/// </summary>
+		std::uint64_t KeyFilter{ 0 };
+		/// <summary>
+		/// The most recently computed structural hash of the scope, valid only while HashValid is set.
+		/// </summary>
+		mutable std::uint64_t CachedHash{ 0 };
+		/// <summary>
+		/// Whether or not CachedHash reflects the current contents of the scope and its descendants. A valid scope always has valid descendants. Atomic, as Datums of sibling scopes may be written
+		/// from different threads during a parallel visit, each invalidating their shared ancestors.
+		/// </summary>
+		mutable std::atomic<bool> HashValid{ false };
+		/// <summary>
+		/// Whether or not CachedHash was computed without leaving out the elements of any Datum that had handed out a mutable reference or span, in this scope or any nested scope, so that differing
+		/// hashes prove inequality. Valid only while HashValid is set.
+		/// </summary>
+		mutable bool HashExact{ false };
+		/// <summary>
+		/// The changes recorded since changes were last cleared, while tracking is enabled.
+		/// </summary>
+		Vector<ChangeRecord> Changes;
+		/// <summary>
+		/// Whether or not changes to the scope are being tracked.
+		/// </summary>
+		bool TrackingChanges{ false };
+		/// <summary>
+		/// Whether or not a tracked change has been made to the scope since changes were last cleared.
+		/// </summary>
+		bool Dirty{ false };
+		/// <summary>
+		/// Whether or not a scope nested inside this one may have been made dirty since changes were last cleared. Always set on every ancestor of a dirty scope. Atomic for the same reason as HashValid.
+		/// </summary>
+		std::atomic<bool> DescendantDirty{ false };
+		/// <summary>
+		/// The block of memory the scope was relocated into by ScopeRelayout, shared by every scope relocated with it and freed once the last of them is destroyed, or nullptr if the scope was allocated
+		/// on its own.
+		/// </summary>
+		std::shared_ptr<void> Arena;
+		/// <summary>
+		/// The slot the scope holds in the ScopeHandleTable, or NoSlot if no handle to the scope has been requested. Passed on to the scope moved into, and released when the scope is destroyed.
+		/// </summary>
+		std::uint32_t HandleSlot{ ScopeHandleTable::NoSlot };
+		/// <summary>
+		/// The first of the attribute indexes rooted at the scope, which are linked through each other, or nullptr if the scope is not the root of any index.
+		/// </summary>
+		AttributeIndexBase* Indexes{ nullptr };
+		/// <summary>
+		/// The observers registered on the scope's Datums, created when the first is registered, or nullptr if the scope has never been observed. Tested before every write, so that unobserved scopes
+		/// pay for nothing more than the test.
+		/// </summary>
+		gsl::owner<DatumObserverList*> Observers{ nullptr };
 	};
 
 	ConcreteFactory(Scope, Scope);
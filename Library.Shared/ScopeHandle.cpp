@@ -0,0 +1,79 @@
+#include "ScopeHandle.h"
+#include "Scope.h"
+
+/// <summary>
+/// Method definitions to support the ScopeHandleTable class.
+/// </summary>
+namespace FieaGameEngine
+{
+	Vector<ScopeHandleTable::Slot> ScopeHandleTable::Slots;
+	std::uint32_t ScopeHandleTable::FirstFree = ScopeHandleTable::NoSlot;
+	std::mutex ScopeHandleTable::IssueMutex;
+	size_t ScopeHandleTable::Live = 0;
+
+	ScopeHandle ScopeHandleTable::HandleOf(Scope& scope)
+	{
+		std::lock_guard<std::mutex> lock(IssueMutex);
+		if (scope.HandleSlot == NoSlot)
+		{
+			if (FirstFree != NoSlot)
+			{
+				scope.HandleSlot = FirstFree;
+				FirstFree = Slots[FirstFree].NextFree;
+			}
+			else
+			{
+				if (Slots.Size() >= NoSlot)
+				{
+					throw std::runtime_error("Cannot issue any more scope handles!");
+				}
+				if (Slots.Size() == Slots.Capacity())
+				{
+					Slots.Reserve(std::max<size_t>(Slots.Capacity() * 2, InitialSlots)); //Doubled, so that issuing handles to many scopes does not copy the table once per scope.
+				}
+				scope.HandleSlot = static_cast<std::uint32_t>(Slots.Size());
+				Slots.PushBack(Slot{ nullptr, 1, NoSlot });
+			}
+			Slots[scope.HandleSlot].Target = &scope;
+			Live++;
+		}
+		return ScopeHandle{ scope.HandleSlot, Slots[scope.HandleSlot].Generation };
+	}
+
+	Scope* ScopeHandleTable::Resolve(ScopeHandle handle)
+	{
+		if (handle.Index >= Slots.Size())
+		{
+			return nullptr;
+		}
+		const Slot& slot = Slots[handle.Index];
+		return slot.Generation == handle.Generation ? slot.Target : nullptr;
+	}
+
+	bool ScopeHandleTable::IsValid(ScopeHandle handle)
+	{
+		return Resolve(handle) != nullptr;
+	}
+
+	size_t ScopeHandleTable::LiveCount()
+	{
+		return Live;
+	}
+
+	void ScopeHandleTable::Retarget(std::uint32_t slot, Scope& scope)
+	{
+		assert(slot < Slots.Size() && Slots[slot].Target != nullptr);
+		Slots[slot].Target = &scope;
+	}
+
+	void ScopeHandleTable::Release(std::uint32_t slot)
+	{
+		assert(slot < Slots.Size() && Slots[slot].Target != nullptr);
+		Slot& released = Slots[slot];
+		released.Target = nullptr;
+		released.Generation = released.Generation == UINT32_MAX ? 1 : released.Generation + 1; //Zero is skipped, as it marks a null handle.
+		released.NextFree = FirstFree;
+		FirstFree = slot;
+		Live--;
+	}
+}
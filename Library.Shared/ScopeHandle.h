@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	class Scope;
+
+	/// <summary>
+	/// The ScopeHandle struct, a weak reference to a Scope made up of a slot index within the ScopeHandleTable and the generation of that slot when the handle was issued. A handle stays valid while
+	/// the scope it refers to is moved, such as by ScopeRelayout, and resolves to nullptr once that scope is destroyed, as destroying it advances the generation of its slot. A zeroed handle, including
+	/// the default constructed one, is null and never resolves.
+	/// </summary>
+	struct ScopeHandle final
+	{
+		std::uint32_t Index{ 0 };
+		std::uint32_t Generation{ 0 };
+
+		/// <summary>
+		/// Returns a boolean indicating whether or not the handle is null, meaning it was never issued for a scope. A handle that is not null may still be stale.
+		/// </summary>
+		/// <returns>A boolean indicating whether or not the handle is null.</returns>
+		[[nodiscard]] bool IsNull() const { return Generation == 0; }
+		bool operator==(const ScopeHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+		bool operator!=(const ScopeHandle& other) const { return !(*this == other); }
+	};
+
+	/// <summary>
+	/// The ScopeHandleTable class, which issues and resolves ScopeHandles. Each scope is given a slot the first time a handle to it is requested, and keeps that slot, along with every handle already
+	/// issued for it, when it is moved; the slot is released when the scope is destroyed, advancing its generation so that outstanding handles go stale, and is then reused by the next scope to request
+	/// one. Resolving a handle is a bounds check, a generation compare and a load, so a stale reference is detected in constant time rather than being followed.
+	///
+	/// The table is shared by every scope. Issuing handles is synchronized, as Datum change notifications issue them from whichever thread writes, including the workers of a parallel visit, but handles
+	/// must not be resolved, nor handled scopes destroyed, while another thread may be issuing one.
+	/// </summary>
+	class ScopeHandleTable final
+	{
+	public:
+		/// <summary>
+		/// Returns the handle of the provided scope, assigning it a slot first if it has none.
+		/// </summary>
+		/// <param name="scope">The scope to get a handle to.</param>
+		/// <returns>A handle that resolves to the provided scope until it is destroyed.</returns>
+		static ScopeHandle HandleOf(Scope& scope);
+		/// <summary>
+		/// Resolves the provided handle to the scope it refers to.
+		/// </summary>
+		/// <param name="handle">The handle to resolve.</param>
+		/// <returns>A pointer to the scope the handle refers to, or nullptr if the handle is null or its scope has been destroyed.</returns>
+		[[nodiscard]] static Scope* Resolve(ScopeHandle handle);
+		/// <summary>
+		/// Returns a boolean indicating whether or not the provided handle still refers to a live scope.
+		/// </summary>
+		/// <param name="handle">The handle being tested.</param>
+		/// <returns>A boolean indicating whether or not the handle resolves to a scope.</returns>
+		[[nodiscard]] static bool IsValid(ScopeHandle handle);
+		/// <summary>
+		/// Returns the number of scopes that currently hold a slot in the table.
+		/// </summary>
+		/// <returns>A size_t indicating the number of slots in use.</returns>
+		[[nodiscard]] static size_t LiveCount();
+
+		/// <summary>
+		/// The slot index stored by a scope that has not been given a slot.
+		/// </summary>
+		static constexpr std::uint32_t NoSlot = UINT32_MAX;
+
+	private:
+		friend Scope;
+
+		/// <summary>
+		/// The number of slots reserved when the first handle is issued.
+		/// </summary>
+		static constexpr size_t InitialSlots = 64;
+
+		/// <summary>
+		/// A single entry of the table. Target is the scope holding the slot, or nullptr while the slot is free, in which case NextFree links it to the next free slot.
+		/// </summary>
+		struct Slot final
+		{
+			Scope* Target;
+			std::uint32_t Generation;
+			std::uint32_t NextFree;
+		};
+
+		/// <summary>
+		/// Points the slot held by a scope at the scope that it was moved into. Called by the Scope move constructor and move assignment operator.
+		/// </summary>
+		static void Retarget(std::uint32_t slot, Scope& scope);
+		/// <summary>
+		/// Frees the provided slot, advancing its generation so that every handle issued for it goes stale. Called when the scope holding it is destroyed.
+		/// </summary>
+		static void Release(std::uint32_t slot);
+
+		static Vector<Slot> Slots;
+		/// <summary>
+		/// Serializes HandleOf, which may grow Slots and take from the free list.
+		/// </summary>
+		static std::mutex IssueMutex;
+		static std::uint32_t FirstFree;
+		static size_t Live;
+	};
+}
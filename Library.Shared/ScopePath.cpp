@@ -0,0 +1,115 @@
+#include "ScopePath.h"
+
+/// <summary>
+/// Method definitions to support the ScopePath class.
+/// </summary>
+namespace FieaGameEngine
+{
+	ScopePath::ScopePath(const std::string& path) :
+		Text(path)
+	{
+		Steps.Reserve(static_cast<size_t>(std::count(path.begin(), path.end(), '.')) + 1);
+		size_t position = 0;
+		do
+		{
+			const size_t keyEnd = path.find_first_of(".[", position);
+			const size_t keyLength = (keyEnd == std::string::npos ? path.size() : keyEnd) - position;
+			if (keyLength == 0)
+			{
+				throw std::runtime_error("Scope paths may not contain empty steps!");
+			}
+
+			std::string key = path.substr(position, keyLength);
+			const std::uint64_t keyMask = Scope::KeyFilterMask(key);
+			Step step{ std::move(key), keyMask, 0 };
+			position += keyLength;
+			LastIndexed = false;
+
+			if (position < path.size() && path[position] == '[')
+			{
+				position++;
+				const size_t digitsStart = position;
+				while (position < path.size() && path[position] >= '0' && path[position] <= '9')
+				{
+					step.Index = (step.Index * 10) + static_cast<size_t>(path[position] - '0');
+					position++;
+				}
+				if (position == digitsStart || position >= path.size() || path[position] != ']')
+				{
+					throw std::runtime_error("Scope path indices must be a number enclosed in brackets!");
+				}
+				position++;
+				LastIndexed = true;
+			}
+
+			Steps.PushBack(std::move(step));
+
+			if (position < path.size())
+			{
+				if (path[position] != '.')
+				{
+					throw std::runtime_error("Scope path steps must be separated by periods!");
+				}
+				position++;
+				if (position == path.size())
+				{
+					throw std::runtime_error("Scope paths may not contain empty steps!");
+				}
+			}
+		} while (position < path.size());
+	}
+
+	const std::string& ScopePath::Source() const
+	{
+		return Text;
+	}
+
+	size_t ScopePath::Depth() const
+	{
+		return Steps.Size();
+	}
+
+	bool ScopePath::HasElementIndex() const
+	{
+		return LastIndexed;
+	}
+
+	std::pair<Datum*, size_t> ScopePath::Find(const Scope& scope) const
+	{
+		if (Steps.IsEmpty())
+		{
+			return std::pair<Datum*, size_t>(nullptr, 0);
+		}
+		return ResolveFrom(scope.FindFiltered(Steps[0].Key, Steps[0].KeyMask));
+	}
+
+	std::pair<Datum*, size_t> ScopePath::Search(const Scope& scope) const
+	{
+		if (Steps.IsEmpty())
+		{
+			return std::pair<Datum*, size_t>(nullptr, 0);
+		}
+		Datum* first = nullptr;
+		for (const Scope* current = &scope; current != nullptr && first == nullptr; current = current->GetParent())
+		{
+			first = current->FindFiltered(Steps[0].Key, Steps[0].KeyMask);
+		}
+		return ResolveFrom(first);
+	}
+
+	std::pair<Datum*, size_t> ScopePath::ResolveFrom(Datum* first) const
+	{
+		Datum* datum = first;
+		for (size_t i = 1; i < Steps.Size() && datum != nullptr; i++)
+		{
+			const size_t scopeIndex = Steps[i - 1].Index;
+			if (datum->Type() != Datum::DatumTypes::Table || scopeIndex >= datum->Size())
+			{
+				datum = nullptr;
+				break;
+			}
+			datum = datum->GetConstScope(scopeIndex)->FindFiltered(Steps[i].Key, Steps[i].KeyMask);
+		}
+		return std::pair<Datum*, size_t>(datum, datum != nullptr ? Steps.Back().Index : 0);
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "Scope.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// The ScopePath class, which names a Datum nested inside of a Scope hierarchy with a dotted path such as "Children.Enemy.Health[2]". Each step of the path is a key, optionally followed by an index
+	/// in brackets. Every step but the last must name a Table Datum, and its index selects which of the Table's scopes the next step is looked up in; the index of the last step selects an element of
+	/// the named Datum. Steps without an index use index zero.
+	///
+	/// A path is parsed once, when constructed, into its keys, their key filter masks and their indices. Resolving a path afterwards performs one lookup per step, and neither parses, hashes nor
+	/// allocates, so a compiled path may be kept and resolved every frame.
+	/// </summary>
+	class ScopePath final
+	{
+	public:
+		/// <summary>
+		/// Default constructor for the ScopePath, creating an empty path that never resolves.
+		/// </summary>
+		ScopePath() = default;
+		/// <summary>
+		/// Constructor for the ScopePath, parsing the provided dotted path. Throws a runtime error if the path is empty, has an empty step, or has an index that is not a closed run of digits.
+		/// </summary>
+		/// <param name="path">The dotted path to parse, such as "Children.Enemy.Health[2]".</param>
+		explicit ScopePath(const std::string& path);
+
+		/// <summary>
+		/// Returns the text the path was parsed from.
+		/// </summary>
+		/// <returns>A const reference to the text of the path.</returns>
+		[[nodiscard]] const std::string& Source() const;
+		/// <summary>
+		/// Returns the number of steps in the path, which is zero for an empty path.
+		/// </summary>
+		/// <returns>A size_t indicating the number of steps in the path.</returns>
+		[[nodiscard]] size_t Depth() const;
+		/// <summary>
+		/// Returns a boolean indicating whether or not the last step of the path names an element index explicitly, as opposed to defaulting to zero.
+		/// </summary>
+		/// <returns>A boolean indicating whether or not the last step has an index.</returns>
+		[[nodiscard]] bool HasElementIndex() const;
+
+		/// <summary>
+		/// Resolves the path starting from the provided scope, looking up the first step in that scope alone.
+		/// </summary>
+		/// <param name="scope">The scope the first step is looked up in.</param>
+		/// <returns>A pair made up of the Datum named by the last step and the element index it selects. The Datum* is nullptr if any step could not be resolved.</returns>
+		[[nodiscard]] std::pair<Datum*, size_t> Find(const Scope& scope) const;
+		/// <summary>
+		/// Resolves the path starting from the provided scope, looking up the first step in that scope and then its ancestors, as Scope::Search does. Later steps are looked up only in the scopes
+		/// selected by the steps before them.
+		/// </summary>
+		/// <param name="scope">The scope the search for the first step begins in.</param>
+		/// <returns>A pair made up of the Datum named by the last step and the element index it selects. The Datum* is nullptr if any step could not be resolved.</returns>
+		[[nodiscard]] std::pair<Datum*, size_t> Search(const Scope& scope) const;
+
+	private:
+		/// <summary>
+		/// A single step of a parsed path.
+		/// </summary>
+		struct Step final
+		{
+			std::string Key;
+			std::uint64_t KeyMask;
+			size_t Index;
+		};
+
+		[[nodiscard]] std::pair<Datum*, size_t> ResolveFrom(Datum* first) const;
+
+		std::string Text;
+		Vector<Step> Steps;
+		bool LastIndexed{ false };
+	};
+}
@@ -0,0 +1,38 @@
+#include "ScopePublisher.h"
+
+/// <summary>
+/// Method definitions to support the ScopePublisher class.
+/// </summary>
+namespace FieaGameEngine
+{
+	ScopePublisher::ScopePublisher(Scope& source) :
+		SourceScope(&source)
+	{
+	}
+
+	std::uint64_t ScopePublisher::Publish()
+	{
+		Snapshot snapshot(SourceScope->Clone());
+		Scope& published = const_cast<Scope&>(*snapshot);
+		published.Freeze();
+		static_cast<void>(published.StructuralHash()); //Cached before any reader sees the snapshot, so that readers asking for it only ever read the cache.
+
+		std::atomic_store_explicit(&Current, std::move(snapshot), std::memory_order_release);
+		return ++CurrentVersion;
+	}
+
+	ScopePublisher::Snapshot ScopePublisher::Acquire() const
+	{
+		return std::atomic_load_explicit(&Current, std::memory_order_acquire);
+	}
+
+	std::uint64_t ScopePublisher::Version() const
+	{
+		return CurrentVersion.load();
+	}
+
+	Scope& ScopePublisher::Source() const
+	{
+		return *SourceScope;
+	}
+}
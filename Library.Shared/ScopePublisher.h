@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "Scope.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// The ScopePublisher class, which lets other threads read a Scope hierarchy while the thread that owns it keeps modifying it, in the manner of read-copy-update. The owning thread calls Publish
+	/// at a point where the hierarchy is consistent, such as the end of a frame, which clones the hierarchy, freezes the clone and makes it the current snapshot. Reader threads call Acquire to get the
+	/// current snapshot and read from it for as long as they hold it; publishing a newer snapshot never waits on, nor changes, a snapshot that a reader still holds, and each snapshot is deleted by whichever
+	/// thread releases the last reference to it.
+	///
+	/// A snapshot is frozen and its structural hash is computed before it is published, so concurrent readers may use Find, Search, At, StructuralHash, equality and the const Datum getters freely.
+	/// Readers must not use the mutable Datum getters or setters, request handles, or otherwise modify a snapshot, as those writes are not synchronized.
+	/// </summary>
+	class ScopePublisher final
+	{
+	public:
+		/// <summary>
+		/// A reference to a published snapshot, which keeps the snapshot alive while it is held.
+		/// </summary>
+		using Snapshot = std::shared_ptr<const Scope>;
+
+		/// <summary>
+		/// Constructor for the ScopePublisher, which publishes the provided scope's hierarchy. The scope must outlive the publisher.
+		/// </summary>
+		/// <param name="source">The scope whose hierarchy is published.</param>
+		explicit ScopePublisher(Scope& source);
+		ScopePublisher(const ScopePublisher&) = delete;
+		ScopePublisher& operator=(const ScopePublisher&) = delete;
+		ScopePublisher(ScopePublisher&&) = delete;
+		ScopePublisher& operator=(ScopePublisher&&) = delete;
+		~ScopePublisher() = default;
+
+		/// <summary>
+		/// Clones the source hierarchy and makes the clone the current snapshot. Must be called on the thread that modifies the source, while no other thread modifies it. Readers are never blocked;
+		/// one that acquires a snapshot while Publish runs receives either the previous snapshot or the new one.
+		/// </summary>
+		/// <returns>The version number of the newly published snapshot.</returns>
+		std::uint64_t Publish();
+		/// <summary>
+		/// Returns the current snapshot, or nullptr if none has been published. Safe to call from any thread.
+		/// </summary>
+		/// <returns>A reference to the current snapshot, which remains valid and unchanged for as long as it is held.</returns>
+		[[nodiscard]] Snapshot Acquire() const;
+		/// <summary>
+		/// Returns the version number of the current snapshot, which starts at zero and increases by one with each call to Publish. Safe to call from any thread.
+		/// </summary>
+		/// <returns>The version number of the current snapshot.</returns>
+		[[nodiscard]] std::uint64_t Version() const;
+		/// <summary>
+		/// Returns the scope whose hierarchy is published.
+		/// </summary>
+		/// <returns>A reference to the published scope.</returns>
+		[[nodiscard]] Scope& Source() const;
+
+	private:
+		Scope* SourceScope;
+		/// <summary>
+		/// The current snapshot. Only ever accessed through the atomic shared_ptr functions, so that readers may load it while Publish replaces it.
+		/// </summary>
+		Snapshot Current;
+		std::atomic<std::uint64_t> CurrentVersion{ 0 };
+	};
+}
@@ -0,0 +1,129 @@
+#include "ScopeRelayout.h"
+
+/// <summary>
+/// Method definitions to support the ScopeRelayout class.
+/// </summary>
+namespace FieaGameEngine
+{
+	HashMap<RTTI::IdType, ScopeRelayout::TypeRecord> ScopeRelayout::Types;
+
+	void ScopeRelayout::UnregisterType(RTTI::IdType typeId)
+	{
+		Types.Remove(typeId);
+	}
+
+	bool ScopeRelayout::IsRegistered(RTTI::IdType typeId)
+	{
+		return Types.ContainsKey(typeId);
+	}
+
+	size_t ScopeRelayout::Relayout(Scope& root, LayoutOrder order)
+	{
+		//Every nested scope is gathered in its final order before any is moved, while the hierarchy still holds its original pointers.
+		Vector<NestedSlot> slots;
+		if (order == LayoutOrder::BreadthFirst)
+		{
+			GatherNested(root, slots, false);
+			for (size_t i = 0; i < slots.Size(); i++)
+			{
+				GatherNested(*slots[i].Nested, slots, false);
+			}
+		}
+		else
+		{
+			Vector<NestedSlot> pending;
+			GatherNested(root, pending, true);
+			while (!pending.IsEmpty())
+			{
+				NestedSlot slot = pending.Back();
+				pending.PopBack();
+				slots.PushBack(slot);
+				GatherNested(*slot.Nested, pending, true); //Children are pushed in reverse so that the first child is placed next.
+			}
+		}
+
+		//Measure the block, placing each relocated scope at the next offset suitably aligned for its type.
+		Vector<const TypeRecord*> records;
+		Vector<size_t> offsets;
+		records.Reserve(slots.Size());
+		offsets.Reserve(slots.Size());
+		size_t blockSize = 0;
+		size_t relocatedCount = 0;
+		for (size_t i = 0; i < slots.Size(); i++)
+		{
+			const TypeRecord* record = nullptr;
+			const RTTI::IdType typeId = slots[i].Nested->TypeIdInstance();
+			if (Types.ContainsKey(typeId))
+			{
+				record = &Types.At(typeId);
+				blockSize = (blockSize + record->Alignment - 1) & ~(record->Alignment - 1);
+				offsets.PushBack(blockSize);
+				blockSize += record->Size;
+				relocatedCount++;
+			}
+			else
+			{
+				offsets.PushBack(0);
+			}
+			records.PushBack(record);
+		}
+		if (relocatedCount == 0)
+		{
+			return 0;
+		}
+
+		std::byte* block = static_cast<std::byte*>(malloc(blockSize));
+		assert(block != nullptr);
+		std::shared_ptr<void> arena(block, free);
+
+		//Parents are placed before their children in either order, so by the time a scope is moved its parent already lives at its final address and has been made the scope's Parent.
+		for (size_t i = 0; i < slots.Size(); i++)
+		{
+			if (records[i] == nullptr)
+			{
+				continue;
+			}
+
+			NestedSlot& slot = slots[i];
+			Scope* parent = slot.Nested->Parent;
+			slot.Nested->Parent = nullptr; //Detached first, so that emptying the moved scope is not reported to its ancestors.
+			Scope* relocated = records[i]->MoveInto(block + offsets[i], *slot.Nested);
+			relocated->Arena = arena;
+			relocated->Parent = parent;
+			slot.Table->Data.t[slot.Index] = relocated;
+			Scope::DestroyNested(slot.Nested);
+		}
+		return relocatedCount;
+	}
+
+	gsl::owner<Scope*> ScopeRelayout::MoveToHeap(Scope& scope)
+	{
+		const RTTI::IdType typeId = scope.TypeIdInstance();
+		assert(Types.ContainsKey(typeId)); //A scope can only have been relocated if its type was registered.
+		return Types.At(typeId).MoveToHeap(scope);
+	}
+
+	void ScopeRelayout::GatherNested(Scope& scope, Vector<NestedSlot>& slots, bool reverse)
+	{
+		const size_t first = slots.Size();
+		for (size_t i = 0; i < scope.OrderTable.Size(); i++)
+		{
+			Datum& datum = scope.OrderTable[i]->second;
+			if (datum.Type() == Datum::DatumTypes::Table)
+			{
+				for (size_t j = 0; j < datum.Size(); j++)
+				{
+					slots.PushBack(NestedSlot{ datum.GetConstScope(j), &datum, j });
+				}
+			}
+		}
+
+		if (reverse)
+		{
+			for (size_t low = first, high = slots.Size(); low + 1 < high; low++, high--)
+			{
+				std::swap(slots[low], slots[high - 1]);
+			}
+		}
+	}
+}
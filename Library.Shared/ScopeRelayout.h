@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include "Scope.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// The ScopeRelayout class, which relocates the scopes nested inside of a hierarchy into a single contiguous block of memory, in breadth first or depth first order. Scopes created while loading, such
+	/// as by the JSON parser, are scattered across the heap in the order they were created, so walking the hierarchy each frame jumps between unrelated cache lines; once relocated, a walk in the same order
+	/// reads memory front to back. Parent pointers and the Table datums referencing each relocated scope are updated, while keys, Datums, cached hashes and change journals are carried over as they were.
+	///
+	/// Each scope is move constructed into place as its own type, so only scopes whose exact type has been registered are relocated; scopes of other types stay where they are, though their descendants
+	/// may still be relocated. A registered type must not be referenced by pointer from outside of its hierarchy, such as by an event subscription, since such pointers are not updated. Any pointers to
+	/// relocated scopes held by the caller are invalidated, while pointers to their Datums remain valid.
+	/// </summary>
+	class ScopeRelayout final
+	{
+	public:
+		/// <summary>
+		/// The order in which relocated scopes are placed in memory. Breadth first keeps siblings together, suiting walks over one level of the hierarchy at a time, while depth first keeps each
+		/// subtree together, matching a recursive walk such as GameObject::Update.
+		/// </summary>
+		enum class LayoutOrder
+		{
+			BreadthFirst,
+			DepthFirst
+		};
+
+		/// <summary>
+		/// Registers type T for relocation. T must derive from Scope and be move constructible; its move constructor is used to relocate instances, and must leave the moved instance safe to destroy.
+		/// </summary>
+		template <typename T>
+		static void RegisterType();
+		/// <summary>
+		/// Removes the registration of the type with the provided RTTI type id, if any. Must not be called while relocated scopes of the type remain, as orphaning them relies on the registration.
+		/// </summary>
+		/// <param name="typeId">The RTTI type id of the type to stop relocating.</param>
+		static void UnregisterType(RTTI::IdType typeId);
+		/// <summary>
+		/// Returns a boolean indicating whether or not the type with the provided RTTI type id has been registered for relocation.
+		/// </summary>
+		/// <param name="typeId">The RTTI type id being tested.</param>
+		/// <returns>A boolean indicating whether or not the type is registered.</returns>
+		[[nodiscard]] static bool IsRegistered(RTTI::IdType typeId);
+
+		/// <summary>
+		/// Relocates every scope of a registered type nested inside of the provided scope into a newly allocated block, placed in the requested order. The provided scope itself is not moved, as it may
+		/// be owned by the caller or live on the stack. Scopes relocated by an earlier call are relocated again, and their previous block is freed once no scope remains in it.
+		/// </summary>
+		/// <param name="root">The scope whose descendants are relocated.</param>
+		/// <param name="order">The order in which relocated scopes are placed in memory.</param>
+		/// <returns>The number of scopes that were relocated.</returns>
+		static size_t Relayout(Scope& root, LayoutOrder order = LayoutOrder::BreadthFirst);
+
+	private:
+		friend Scope;
+
+		/// <summary>
+		/// The relocation operations for a single registered type.
+		/// </summary>
+		struct TypeRecord final
+		{
+			size_t Size;
+			size_t Alignment;
+			Scope* (*MoveInto)(void* memory, Scope& scope);
+			gsl::owner<Scope*> (*MoveToHeap)(Scope& scope);
+		};
+
+		/// <summary>
+		/// A nested scope, along with the Table datum and index that reference it.
+		/// </summary>
+		struct NestedSlot final
+		{
+			Scope* Nested;
+			Datum* Table;
+			size_t Index;
+		};
+
+		/// <summary>
+		/// Moves the provided relocated scope into an allocation of its own, returning the new scope. Used by Scope::Orphan before handing ownership of a relocated scope to the caller.
+		/// </summary>
+		[[nodiscard]] static gsl::owner<Scope*> MoveToHeap(Scope& scope);
+		static void GatherNested(Scope& scope, Vector<NestedSlot>& slots, bool reverse);
+
+		/// <summary>
+		/// The relocation operations of every registered type, keyed by RTTI type id.
+		/// </summary>
+		static HashMap<RTTI::IdType, TypeRecord> Types;
+	};
+
+	template <typename T>
+	inline void ScopeRelayout::RegisterType()
+	{
+		static_assert(std::is_base_of_v<Scope, T>, "Only types derived from Scope may be relocated.");
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Relocated types may not be over-aligned.");
+
+		TypeRecord record{ sizeof(T), alignof(T),
+			[](void* memory, Scope& scope) -> Scope* { return new(memory) T(std::move(static_cast<T&>(scope))); },
+			[](Scope& scope) -> gsl::owner<Scope*> { return new T(std::move(static_cast<T&>(scope))); } };
+		if (Types.ContainsKey(T::TypeIdClass()))
+		{
+			Types.At(T::TypeIdClass()) = record;
+		}
+		else
+		{
+			Types.Insert(std::pair(T::TypeIdClass(), record));
+		}
+	}
+}
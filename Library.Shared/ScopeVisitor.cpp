@@ -0,0 +1,168 @@
+#include "ScopeVisitor.h"
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Method definitions to support the ScopeVisitor class.
+/// </summary>
+namespace FieaGameEngine
+{
+	ScopeVisitor::ScopeVisitor(VisitFunction function, VisitOrder order, RTTI::IdType typeFilter) :
+		Function(std::move(function)), Order(order), TypeFilter(typeFilter)
+	{
+		if (!Function)
+		{
+			throw std::runtime_error("ScopeVisitor requires a function to call on visited scopes.");
+		}
+	}
+
+	void ScopeVisitor::Visit(Scope& root) const
+	{
+		VisitSubtree(root);
+	}
+
+	void ScopeVisitor::VisitParallel(Scope& root, size_t threadCount) const
+	{
+		if (threadCount == 0)
+		{
+			threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+		}
+
+		//Expand the hierarchy breadth first until there are enough subtrees to keep every thread busy. Expanded scopes are visited on this thread, outside of the parallel phase.
+		Vector<Scope*> expanded;
+		Vector<Scope*> frontier;
+		frontier.PushBack(&root);
+		const size_t targetSubtrees = threadCount * SubtreesPerThread;
+		while (threadCount > 1 && frontier.Size() < targetSubtrees)
+		{
+			Vector<Scope*> next;
+			for (size_t i = 0; i < frontier.Size(); i++)
+			{
+				GatherChildren(*frontier[i], next);
+			}
+			if (next.IsEmpty())
+			{
+				break; //The hierarchy ran out of depth first, so the last frontier is split among the threads as it is.
+			}
+			for (size_t i = 0; i < frontier.Size(); i++)
+			{
+				expanded.PushBack(frontier[i]);
+			}
+			frontier = std::move(next);
+		}
+
+		if (threadCount == 1 || frontier.Size() < 2)
+		{
+			//Too narrow to split; the whole hierarchy is visited in order on this thread.
+			VisitSubtree(root);
+			return;
+		}
+
+		if (Order == VisitOrder::PreOrder)
+		{
+			for (size_t i = 0; i < expanded.Size(); i++)
+			{
+				VisitScope(*expanded[i]);
+			}
+		}
+
+		std::atomic<size_t> nextSubtree{ 0 };
+		std::atomic<bool> failed{ false };
+		std::exception_ptr firstException;
+		std::mutex exceptionMutex;
+		auto worker = [&]()
+		{
+			for (size_t i = nextSubtree++; i < frontier.Size() && !failed.load(); i = nextSubtree++)
+			{
+				try
+				{
+					VisitSubtree(*frontier[i]);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(exceptionMutex);
+					if (firstException == nullptr)
+					{
+						firstException = std::current_exception();
+					}
+					failed = true;
+				}
+			}
+		};
+
+		std::vector<std::thread> workers;
+		const size_t workerCount = std::min(threadCount, frontier.Size()) - 1;
+		workers.reserve(workerCount);
+		for (size_t i = 0; i < workerCount; i++)
+		{
+			workers.emplace_back(worker);
+		}
+		worker();
+		for (std::thread& thread : workers)
+		{
+			thread.join();
+		}
+
+		if (firstException != nullptr)
+		{
+			std::rethrow_exception(firstException);
+		}
+
+		if (Order == VisitOrder::PostOrder)
+		{
+			//Reverse breadth first order visits every expanded scope after all of its descendants.
+			for (size_t i = expanded.Size(); i > 0; i--)
+			{
+				VisitScope(*expanded[i - 1]);
+			}
+		}
+	}
+
+	void ScopeVisitor::VisitSubtree(Scope& scope) const
+	{
+		if (Order == VisitOrder::PreOrder)
+		{
+			VisitScope(scope);
+		}
+
+		//Children are gathered before any are visited, so that a visit function changing the Datums of the visited scope does not disturb the walk.
+		Vector<Scope*> children;
+		GatherChildren(scope, children);
+		for (size_t i = 0; i < children.Size(); i++)
+		{
+			VisitSubtree(*children[i]);
+		}
+
+		if (Order == VisitOrder::PostOrder)
+		{
+			VisitScope(scope);
+		}
+	}
+
+	void ScopeVisitor::VisitScope(Scope& scope) const
+	{
+		if (scope.Is(TypeFilter))
+		{
+			Function(scope);
+		}
+	}
+
+	void ScopeVisitor::GatherChildren(const Scope& scope, Vector<Scope*>& children)
+	{
+		//Reads the order table directly, as the virtual At looks each entry up by key on Attributed scopes.
+		for (size_t i = 0; i < scope.OrderTable.Size(); i++)
+		{
+			const Datum& datum = scope.OrderTable[i]->second;
+			if (datum.Type() == Datum::DatumTypes::Table)
+			{
+				for (size_t j = 0; j < datum.Size(); j++)
+				{
+					children.PushBack(datum.GetConstScope(j));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <functional>
+#include "Scope.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// The ScopeVisitor class, which walks a Scope hierarchy and calls a user-provided function on every nested scope, following the Table datums of each scope in the order they were appended. Scopes
+	/// may be visited before their children (pre-order) or after them (post-order), and may be filtered by RTTI type; scopes that do not match the filter are still walked through, only not visited.
+	///
+	/// Visits may also be run in parallel, splitting the hierarchy into subtrees that are spread across worker threads. Parents are still visited before their descendants in pre-order, and after
+	/// them in post-order, but the order between sibling subtrees is not defined. While a parallel visit is running, the visit function:
+	/// - may read and write the Datums of the scope it was given, including through mutable getters, as change notifications to shared ancestors are thread safe;
+	/// - may read other scopes only through const access, such as Find, Search, GetConstScope and the GetConst getters, and must not write to them;
+	/// - must not change the structure of any scope in the hierarchy, meaning no Append, AppendScope, Adopt, Orphan, Clear, Freeze or assignment;
+	/// - must not call StructuralHash, GetChanges or ClearChanges on any scope in the hierarchy.
+	/// An exception thrown by the visit function on any thread stops workers from starting new subtrees, and the first such exception is rethrown on the calling thread once all workers have finished.
+	/// </summary>
+	class ScopeVisitor final
+	{
+	public:
+		/// <summary>
+		/// The order in which a scope is visited relative to the scopes nested inside of it.
+		/// </summary>
+		enum class VisitOrder
+		{
+			PreOrder,
+			PostOrder
+		};
+
+		using VisitFunction = std::function<void(Scope&)>;
+
+		/// <summary>
+		/// Constructor for the ScopeVisitor, taking the function called on each visited scope, the order of visits, and the RTTI type a scope must be to be visited. By default, every scope is visited.
+		/// </summary>
+		/// <param name="function">The function called on each visited scope.</param>
+		/// <param name="order">Whether scopes are visited before or after the scopes nested inside of them.</param>
+		/// <param name="typeFilter">The RTTI type id a scope must match, through RTTI::Is, to be visited.</param>
+		explicit ScopeVisitor(VisitFunction function, VisitOrder order = VisitOrder::PreOrder, RTTI::IdType typeFilter = Scope::TypeIdClass());
+
+		/// <summary>
+		/// Creates a ScopeVisitor that only visits scopes of type T or derived from it, passing them to the provided function as T.
+		/// </summary>
+		/// <param name="function">The function called on each visited scope of type T.</param>
+		/// <param name="order">Whether scopes are visited before or after the scopes nested inside of them.</param>
+		/// <returns>A ScopeVisitor filtered to type T.</returns>
+		template <typename T>
+		[[nodiscard]] static ScopeVisitor OfType(std::function<void(T&)> function, VisitOrder order = VisitOrder::PreOrder);
+
+		/// <summary>
+		/// Visits the provided scope and every scope nested inside of it on the calling thread, in the visitor's order.
+		/// </summary>
+		/// <param name="root">The scope at the top of the hierarchy being visited.</param>
+		void Visit(Scope& root) const;
+		/// <summary>
+		/// Visits the provided scope and every scope nested inside of it, spreading subtrees across worker threads. The calling thread takes part in the visit, and the call returns once every scope
+		/// has been visited. Hierarchies too narrow to split are visited on the calling thread alone.
+		/// </summary>
+		/// <param name="root">The scope at the top of the hierarchy being visited.</param>
+		/// <param name="threadCount">The number of threads to visit with, including the calling thread. Zero uses the number of hardware threads available.</param>
+		void VisitParallel(Scope& root, size_t threadCount = 0) const;
+
+	private:
+		void VisitSubtree(Scope& scope) const;
+		void VisitScope(Scope& scope) const;
+		static void GatherChildren(const Scope& scope, Vector<Scope*>& children);
+
+		/// <summary>
+		/// The number of subtrees, per thread, that a parallel visit tries to split the hierarchy into, so that uneven subtrees still balance across threads.
+		/// </summary>
+		static constexpr size_t SubtreesPerThread = 4;
+
+		VisitFunction Function;
+		VisitOrder Order;
+		RTTI::IdType TypeFilter;
+	};
+
+	template <typename T>
+	inline ScopeVisitor ScopeVisitor::OfType(std::function<void(T&)> function, VisitOrder order)
+	{
+		return ScopeVisitor([function](Scope& scope) { function(static_cast<T&>(scope)); }, order, T::TypeIdClass());
+	}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+/// <summary>
+/// Selects the SIMD instruction set used by the vectorized kernels of the library, such as those of DatumMath, at compile time. FIEA_SIMD_AVX2 is defined when building for AVX2, such as with
+/// /arch:AVX2, and FIEA_SIMD_SSE2 otherwise on x86 and x64, where SSE2 is always present. Neither is defined on other platforms, whose kernels fall back to plain loops. FIEA_SIMD_FMA is defined along
+/// with FIEA_SIMD_AVX2 where fused multiply-add instructions may be used.
+/// </summary>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define FIEA_SIMD_AVX2
+#if defined(__FMA__) || defined(_MSC_VER)
+#define FIEA_SIMD_FMA //Every processor with AVX2 has FMA, but only MSVC assumes it when building for AVX2.
+#endif
+#elif defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FIEA_SIMD_SSE2
+#endif
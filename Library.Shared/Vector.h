@@ -5,6 +5,8 @@
 #include <limits>
 #include <stdexcept>
 #include <iterator>
+#include <type_traits>
+#include "AlignedMemory.h"
 /// <summary>
 /// The file specifying the Vector template class, which is used to create Vectors that can be traversed in either direction. Includes definition for Vectors of a user-defined type and iterators. Includes functions to wipe, initialize,
 /// and copy Vectors. Allows users to push and pop data values onto the Vector, as well as iterate through and insert or remove elements between values.
@@ -289,6 +291,10 @@ namespace FieaGameEngine
 			/// A pointer to the start of the Vector. Stored to allow access to any element inside the Vector.
 			/// </summary>
 			pointer VectorData = nullptr;
+			/// <summary>
+			/// Moves the elements of the Vector into storage for the provided number of elements, which must be no fewer than its size.
+			/// </summary>
+			void Relocate(size_type elements);
 
 		public:
 			friend Iterator;
@@ -377,7 +383,7 @@ namespace FieaGameEngine
 			size_type Capacity() const;
 
 			/// <summary>
-			/// Used to allocate more space to the vector. Argument specifies how many elements the Vector should be able to hold.
+			/// Used to allocate more space to the vector. Argument specifies how many elements the Vector should be able to hold. Storage is aligned as chosen by AlignedMemory::AlignmentOf for T.
 			/// </summary>
 			void Reserve(const size_type elements);
 			/// <summary>
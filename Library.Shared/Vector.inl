@@ -645,11 +645,7 @@ namespace FieaGameEngine
 
 		if (elements > VectorCapacity)
 		{
-			T* newData;
-			newData = reinterpret_cast<T*>(realloc(VectorData, elements * sizeof(T)));
-			assert(newData != nullptr);
-			VectorData = newData;
-			VectorCapacity = elements;
+			Relocate(elements);
 		}
 	}
 
@@ -658,18 +654,37 @@ namespace FieaGameEngine
 	{
 		if (VectorSize == 0)
 		{
-			free(VectorData);
+			AlignedMemory::Free(VectorData);
 			VectorSize = 0;
 			VectorCapacity = 0;
 			VectorData = nullptr;
 		}
 		else if(VectorSize != VectorCapacity)
 		{
-			T* newData = reinterpret_cast<T*>(realloc(VectorData, VectorSize * sizeof(T)));
+			Relocate(VectorSize);
+		}
+	}
+
+	template<typename T>
+	void Vector<T>::Relocate(size_t elements)
+	{
+		T* newData;
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			newData = static_cast<T*>(AlignedMemory::Reallocate(VectorData, VectorSize * sizeof(T), elements * sizeof(T), AlignedMemory::AlignmentOf<T>()));
+			assert(newData != nullptr);
+		}
+		else
+		{
+			//The aligned block may move, so elements that may point into themselves, such as short strings, are move constructed into place rather than copied bytewise.
+			newData = static_cast<T*>(AlignedMemory::Allocate(elements * sizeof(T), AlignedMemory::AlignmentOf<T>()));
 			assert(newData != nullptr);
-			VectorData = newData;
-			VectorCapacity = VectorSize;
+			std::uninitialized_move(VectorData, VectorData + VectorSize, newData);
+			std::destroy(VectorData, VectorData + VectorSize);
+			AlignedMemory::Free(VectorData);
 		}
+		VectorData = newData;
+		VectorCapacity = elements;
 	}
 
 	template<typename T>